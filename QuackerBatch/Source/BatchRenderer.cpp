@@ -0,0 +1,342 @@
+/*
+  ==============================================================================
+
+    BatchRenderer.cpp
+    Created: 19 Oct 2026 3:26:05am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "BatchRenderer.h"
+
+namespace {
+    constexpr int MIN_BLOCK_SIZE = 16;
+    constexpr int MAX_BLOCK_SIZE = 8192;
+    constexpr int PROGRESS_INTERVAL_MS = 1000;
+
+    // Plays from the start of each file at a fixed tempo, so synced rates behave as in a host
+    class RenderPlayHead : public juce::AudioPlayHead {
+    public:
+        void reset(double newSampleRate, double newBpm) noexcept {
+            sampleRate = newSampleRate;
+            bpm = newBpm;
+            position = 0;
+        }
+
+        void setPosition(juce::int64 newPosition) noexcept { position = newPosition; }
+
+        juce::Optional<PositionInfo> getPosition() const override {
+            const double seconds = static_cast<double>(position) / sampleRate;
+
+            PositionInfo info;
+            info.setIsPlaying(true);
+            info.setBpm(bpm);
+            info.setTimeSignature(juce::AudioPlayHead::TimeSignature{});
+            info.setTimeInSamples(position);
+            info.setTimeInSeconds(seconds);
+            info.setPpqPosition(seconds * bpm / 60.0);
+            return info;
+        }
+
+    private:
+        double sampleRate = 44100.0;
+        double bpm = 120.0;
+        juce::int64 position = 0;
+    };
+
+    juce::AudioChannelSet channelSetFor(int numChannels) {
+        auto set = juce::AudioChannelSet::canonicalChannelSet(numChannels);
+        return set.isDisabled() ? juce::AudioChannelSet::discreteChannels(numChannels) : set;
+    }
+}
+
+//==============================================================================
+class BatchRenderer::Worker : public juce::Thread {
+public:
+    Worker(BatchRenderer& ownerToUse, int index)
+        : juce::Thread("Batch Render " + juce::String(index + 1)),
+          owner(ownerToUse),
+          processor(std::make_unique<QuackerVSTAudioProcessor>()) {
+        formats.registerBasicFormats();
+        processor->setPlayHead(&playHead);
+        processor->setNonRealtime(true);
+    }
+
+    ~Worker() override {
+        stopThread(10000);
+    }
+
+    QuackerVSTAudioProcessor& getProcessor() noexcept { return *processor; }
+
+    void run() override {
+        const auto& jobs = *owner.jobs;
+
+        while (!threadShouldExit()) {
+            const int job = owner.nextJob.fetch_add(1);
+
+            if (job >= static_cast<int>(jobs.size())) {
+                return;
+            }
+
+            juce::String error;
+
+            if (renderFile(jobs[static_cast<size_t>(job)], error)) {
+                ++owner.filesDone;
+            } else {
+                const juce::ScopedLock lock(owner.failureLock);
+                owner.failures.add(jobs[static_cast<size_t>(job)].file.getFullPathName() + ": " + error);
+                ++owner.filesFailed;
+            }
+        }
+    }
+
+private:
+    bool renderFile(const Input& input, juce::String& error) {
+        std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(input.file));
+
+        if (reader == nullptr) {
+            error = "unsupported or unreadable audio file";
+            return false;
+        }
+
+        const int numChannels = static_cast<int>(reader->numChannels);
+        const double sampleRate = reader->sampleRate;
+        const juce::int64 length = reader->lengthInSamples;
+
+        juce::AudioProcessor::BusesLayout layout;
+        layout.inputBuses.add(channelSetFor(numChannels));
+        layout.outputBuses.add(channelSetFor(numChannels));
+
+        if (sampleRate <= 0.0 || !processor->setBusesLayout(layout)) {
+            error = "unsupported channel count or sample rate";
+            return false;
+        }
+
+        auto outputFile = owner.settings.outputDirectory.getChildFile(input.relativePath).withFileExtension("wav");
+        outputFile.getParentDirectory().createDirectory();
+        outputFile.deleteFile();
+
+        auto stream = std::make_unique<juce::FileOutputStream>(outputFile);
+
+        if (!stream->openedOk()) {
+            error = "can't write " + outputFile.getFullPathName();
+            return false;
+        }
+
+        juce::WavAudioFormat wav;
+        std::unique_ptr<juce::AudioFormatWriter> writer(
+            wav.createWriterFor(stream.get(), sampleRate, static_cast<unsigned int>(numChannels),
+                                owner.settings.bitDepth, {}, 0));
+
+        if (writer == nullptr) {
+            error = "can't create a WAV writer for this format";
+            stream.reset();
+            outputFile.deleteFile();
+            return false;
+        }
+
+        stream.release();   // Owned by the writer now
+
+        const int blockSize = owner.settings.blockSize;
+        processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+        processor->prepareToPlay(sampleRate, blockSize);
+        playHead.reset(sampleRate, owner.settings.bpm);
+
+        buffer.setSize(numChannels, blockSize, false, false, true);
+        bool ok = true;
+
+        for (juce::int64 position = 0; position < length; position += blockSize) {
+            if (threadShouldExit()) {
+                error = "cancelled";
+                ok = false;
+                break;
+            }
+
+            const int numSamples = static_cast<int>(juce::jmin<juce::int64>(blockSize, length - position));
+
+            if (!reader->read(&buffer, 0, numSamples, position, true, true)) {
+                error = "read failed at sample " + juce::String(position);
+                ok = false;
+                break;
+            }
+
+            // The processor sees a block of exactly the samples read, like a host's last partial block
+            juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), numChannels, numSamples);
+            midi.clear();
+            playHead.setPosition(position);
+            processor->processBlock(block, midi);
+
+            if (!writer->writeFromAudioSampleBuffer(block, 0, numSamples)) {
+                error = "write failed at sample " + juce::String(position);
+                ok = false;
+                break;
+            }
+        }
+
+        processor->releaseResources();
+        writer.reset();
+
+        if (!ok) {
+            outputFile.deleteFile();
+            return false;
+        }
+
+        owner.microsecondsRendered += static_cast<juce::int64>(static_cast<double>(length) / sampleRate * 1.0e6);
+        return true;
+    }
+
+    BatchRenderer& owner;
+    RenderPlayHead playHead;    // Declared first, so it outlives the processor pointing at it
+    std::unique_ptr<QuackerVSTAudioProcessor> processor;
+    juce::AudioFormatManager formats;
+    juce::AudioBuffer<float> buffer;
+    juce::MidiBuffer midi;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Worker)
+};
+
+//==============================================================================
+BatchRenderer::BatchRenderer(const Settings& newSettings)
+    : settings(newSettings) {
+    settings.blockSize = juce::jlimit(MIN_BLOCK_SIZE, MAX_BLOCK_SIZE, settings.blockSize);
+    settings.bpm = juce::jlimit(20.0, 999.0, settings.bpm);
+
+    if (settings.bitDepth != 16 && settings.bitDepth != 24 && settings.bitDepth != 32) {
+        settings.bitDepth = 24;
+    }
+}
+
+BatchRenderer::~BatchRenderer() = default;
+
+std::vector<BatchRenderer::Input> BatchRenderer::collectInputs(const juce::StringArray& paths,
+                                                                juce::AudioFormatManager& formats) {
+    std::vector<Input> inputs;
+    const auto wildcard = formats.getWildcardForAllFormats();
+
+    for (const auto& path : paths) {
+        const auto target = juce::File::getCurrentWorkingDirectory().getChildFile(path);
+
+        if (target.isDirectory()) {
+            // Keep the folder layout, so renders of same-named files in different folders don't collide
+            for (const auto& entry : juce::RangedDirectoryIterator(target, true, wildcard, juce::File::findFiles)) {
+                const auto file = entry.getFile();
+                inputs.push_back({ file, target.getFileName() + "/" + file.getRelativePathFrom(target) });
+            }
+        } else if (target.existsAsFile()) {
+            inputs.push_back({ target, target.getFileName() });
+        }
+    }
+
+    return inputs;
+}
+
+bool BatchRenderer::applyPreset(QuackerVSTAudioProcessor& processor) {
+    auto& presetManager = processor.getPresetManager();
+
+    if (presetFileState.isValid()) {
+        processor.apvts.replaceState(presetFileState.createCopy());
+        presetManager.applyParametersInCorrectOrder();
+        processor.syncParametersAfterPresetLoad();
+    } else if (!presetManager.loadPreset(settings.preset)) {
+        lastErrorMessage = presetManager.getLastErrorMessage();
+        return false;
+    }
+
+    // Each worker renders a different file, so there's no shared LFO to follow
+    if (auto* linkGroup = processor.apvts.getParameter("linkGroup")) {
+        linkGroup->setValueNotifyingHost(0.0f);
+    }
+
+    return true;
+}
+
+bool BatchRenderer::createWorkers(int count) {
+    const auto presetFile = juce::File::getCurrentWorkingDirectory().getChildFile(settings.preset);
+
+    if (presetFile.existsAsFile()) {
+        auto xml = juce::XmlDocument::parse(presetFile);
+
+        if (xml == nullptr) {
+            lastErrorMessage = "Failed to parse preset file: " + presetFile.getFullPathName();
+            return false;
+        }
+
+        presetFileState = juce::ValueTree::fromXml(*xml);
+
+        if (!presetFileState.isValid()) {
+            lastErrorMessage = "Invalid state in preset file: " + presetFile.getFullPathName();
+            return false;
+        }
+    }
+
+    // Processors are built and configured here, on the message thread, before any worker starts
+    for (int i = static_cast<int>(workers.size()); i < count; ++i) {
+        auto worker = std::make_unique<Worker>(*this, i);
+
+        if (!applyPreset(worker->getProcessor())) {
+            return false;
+        }
+
+        workers.push_back(std::move(worker));
+    }
+
+    return true;
+}
+
+BatchRenderer::Progress BatchRenderer::render(const std::vector<Input>& inputs, ProgressCallback onProgress) {
+    Progress progress;
+    progress.totalFiles = static_cast<int>(inputs.size());
+
+    if (inputs.empty()) {
+        return progress;
+    }
+
+    const int available = settings.numThreads > 0 ? settings.numThreads : juce::SystemStats::getNumCpus();
+    const int numWorkers = juce::jlimit(1, progress.totalFiles, available);
+
+    if (!createWorkers(numWorkers)) {
+        progress.filesFailed = progress.totalFiles;
+        return progress;
+    }
+
+    jobs = &inputs;
+    nextJob = 0;
+    filesDone = 0;
+    filesFailed = 0;
+    microsecondsRendered = 0;
+    failures.clear();
+
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+
+    auto updateProgress = [&] {
+        progress.filesDone = filesDone.load();
+        progress.filesFailed = filesFailed.load();
+        progress.audioSeconds = static_cast<double>(microsecondsRendered.load()) / 1.0e6;
+        progress.wallSeconds = juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - startTicks);
+    };
+
+    for (auto& worker : workers) {
+        worker->startThread(juce::Thread::Priority::normal);
+    }
+
+    for (auto& worker : workers) {
+        while (!worker->waitForThreadToExit(PROGRESS_INTERVAL_MS)) {
+            updateProgress();
+
+            if (onProgress) {
+                onProgress(progress);
+            }
+        }
+    }
+
+    updateProgress();
+    jobs = nullptr;
+    return progress;
+}
+
+juce::StringArray BatchRenderer::getFailures() const {
+    const juce::ScopedLock lock(failureLock);
+    return failures;
+}
@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    BatchRenderer.h
+    Created: 19 Oct 2026 3:26:05am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "../../QuackerVST/Source/PluginProcessor.h"
+
+/**
+ * Renders audio files through the plugin without a host.
+ *
+ * Each worker thread owns one QuackerVSTAudioProcessor, with the preset
+ * already applied on the calling thread. Workers take the next file from a
+ * shared counter, so short and long files balance out across cores. A file
+ * is streamed through the processor one block at a time, from an
+ * AudioFormatReader to a WAV writer, so memory use doesn't depend on file
+ * length. The processor runs non-realtime, at full quality, and a
+ * simulated transport plays from the start of every file at a fixed tempo.
+ */
+class BatchRenderer {
+public:
+    struct Settings {
+        juce::String preset;            // A name from the preset catalog, or a preset file
+        juce::File outputDirectory;
+        double bpm = 120.0;
+        int blockSize = 512;
+        int bitDepth = 24;
+        int numThreads = 0;             // Zero uses every core
+    };
+
+    struct Input {
+        juce::File file;
+        juce::String relativePath;      // Where the render goes under the output directory
+    };
+
+    struct Progress {
+        int filesDone = 0;
+        int filesFailed = 0;
+        int totalFiles = 0;
+        double audioSeconds = 0.0;
+        double wallSeconds = 0.0;
+
+        // Seconds of audio rendered per second of wall-clock time
+        double getRealtimeMultiple() const noexcept {
+            return wallSeconds > 0.0 ? audioSeconds / wallSeconds : 0.0;
+        }
+    };
+
+    using ProgressCallback = std::function<void(const Progress&)>;
+
+    explicit BatchRenderer(const Settings& newSettings);
+    ~BatchRenderer();
+
+    // Expands directories recursively into every readable audio file inside them
+    static std::vector<Input> collectInputs(const juce::StringArray& paths, juce::AudioFormatManager& formats);
+
+    // Renders every input, blocking until done; the callback runs on the calling thread about once a second
+    Progress render(const std::vector<Input>& inputs, ProgressCallback onProgress = {});
+
+    juce::String getLastErrorMessage() const { return lastErrorMessage; }
+
+    // One line per file that failed, in no particular order
+    juce::StringArray getFailures() const;
+
+private:
+    class Worker;
+
+    bool createWorkers(int count);
+    bool applyPreset(QuackerVSTAudioProcessor& processor);
+
+    Settings settings;
+    juce::ValueTree presetFileState;        // Parsed once when the preset is a file
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    // Shared by the workers
+    const std::vector<Input>* jobs = nullptr;
+    std::atomic<int> nextJob{ 0 };
+    std::atomic<int> filesDone{ 0 };
+    std::atomic<int> filesFailed{ 0 };
+    std::atomic<juce::int64> microsecondsRendered{ 0 };  // Audio time, so files at mixed sample rates add up
+    mutable juce::CriticalSection failureLock;
+    juce::StringArray failures;
+
+    juce::String lastErrorMessage;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BatchRenderer)
+};
@@ -0,0 +1,108 @@
+/*
+  ==============================================================================
+
+    LFOLinkGroupsTests.cpp
+    Created: 19 Oct 2026 6:40:18pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../QuackerVST/Source/LFOLinkGroups.h"
+
+namespace {
+    constexpr int GROUP = 2;
+    constexpr int BLOCK_SIZE = 64;
+    constexpr juce::int64 BLOCK_TICKS = 1000;           // Synthetic clock, one block apart
+    constexpr juce::int64 STALE_TICKS = 2 * BLOCK_TICKS;
+}
+
+/**
+ * Leader election and hand-off in a link group, driven by a synthetic clock
+ * so the staleness rule is checked without timing the test itself.
+ */
+class LFOLinkGroupsTests : public juce::UnitTest {
+public:
+    LFOLinkGroupsTests() : juce::UnitTest("LFO link groups", "Quacker") {}
+
+    void runTest() override {
+        int first = 0, second = 0, third = 0;  // Only their addresses identify the members
+
+        beginTest("The first member leads, and others follow while it publishes");
+        {
+            LFOLinkGroups groups;
+            juce::int64 now = 0;
+
+            expect(groups.lead(GROUP, &first, now, STALE_TICKS));
+            expect(groups.lead(GROUP, &first, now, STALE_TICKS));
+            publishBlock(groups, 0, 0.25, now);
+
+            for (int block = 1; block < 10; ++block) {
+                now += BLOCK_TICKS;
+                expect(!groups.lead(GROUP, &second, now, STALE_TICKS));
+                expect(groups.lead(GROUP, &first, now, STALE_TICKS));
+                publishBlock(groups, block * BLOCK_SIZE, 0.25, now);
+            }
+
+            expectEquals(readBlock(groups, 9 * BLOCK_SIZE), 0.25);
+        }
+
+        beginTest("A leader that stops publishing hands the lead to the next member");
+        {
+            LFOLinkGroups groups;
+            juce::int64 now = 0;
+
+            expect(groups.lead(GROUP, &first, now, STALE_TICKS));
+            publishBlock(groups, 0, 0.25, now);
+
+            // The leader is bypassed from here on; one block late is still within the grace period
+            now += BLOCK_TICKS;
+            expect(!groups.lead(GROUP, &second, now, STALE_TICKS));
+
+            now += 2 * BLOCK_TICKS;
+            expect(groups.lead(GROUP, &second, now, STALE_TICKS));
+            expect(!groups.lead(GROUP, &third, now, STALE_TICKS), "Only one member takes over");
+            publishBlock(groups, 3 * BLOCK_SIZE, 0.5, now);
+
+            // The group follows the new leader's blocks
+            expectEquals(readBlock(groups, 3 * BLOCK_SIZE), 0.5);
+
+            // The old leader comes back as a member while the new one keeps publishing
+            now += BLOCK_TICKS;
+            expect(!groups.lead(GROUP, &first, now, STALE_TICKS));
+            expect(groups.lead(GROUP, &second, now, STALE_TICKS));
+        }
+
+        beginTest("Leaving frees the lead at once");
+        {
+            LFOLinkGroups groups;
+
+            expect(groups.lead(GROUP, &first, 0, STALE_TICKS));
+            groups.leave(GROUP, &second);
+            expect(!groups.lead(GROUP, &second, 0, STALE_TICKS), "Only the leader can leave");
+
+            groups.leave(GROUP, &first);
+            expect(groups.lead(GROUP, &second, 0, STALE_TICKS));
+        }
+    }
+
+private:
+    static void publishBlock(LFOLinkGroups& groups, juce::int64 hostPosition, double endCyclePosition, juce::int64 now) {
+        float values[BLOCK_SIZE], phases[BLOCK_SIZE], depths[BLOCK_SIZE];
+        std::fill(std::begin(values), std::end(values), 0.5f);
+        std::fill(std::begin(phases), std::end(phases), 0.0f);
+        std::fill(std::begin(depths), std::end(depths), 1.0f);
+        groups.publish(GROUP, hostPosition, values, phases, depths, BLOCK_SIZE, endCyclePosition, now);
+    }
+
+    // The published cycle position for the block, or -1 if it can't be read
+    static double readBlock(const LFOLinkGroups& groups, juce::int64 hostPosition) {
+        float values[BLOCK_SIZE], phases[BLOCK_SIZE], depths[BLOCK_SIZE];
+        double endCyclePosition = -1.0;
+        return groups.read(GROUP, hostPosition, values, phases, depths, BLOCK_SIZE, endCyclePosition)
+                   ? endCyclePosition : -1.0;
+    }
+};
+
+static LFOLinkGroupsTests lfoLinkGroupsTests;
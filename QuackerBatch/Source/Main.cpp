@@ -0,0 +1,163 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 19 Oct 2026 3:26:05am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "BatchRenderer.h"
+
+namespace
+{
+    void printUsage()
+    {
+        std::cout << "Renders audio files through Quacker with a preset, writing WAV files.\n\n"
+                     "Usage: QuackerBatch --preset <name|file> [options] <files or folders>...\n\n"
+                     "Options:\n"
+                     "  --output <folder>     Where renders go (default: ./rendered)\n"
+                     "  --threads <n>         Worker threads (default: one per core)\n"
+                     "  --block-size <n>      Samples per processing block (default: 512)\n"
+                     "  --bpm <n>             Tempo for synced LFO rates (default: 120)\n"
+                     "  --bits <16|24|32>     Output bit depth; 32 writes float (default: 24)\n"
+                     "  --check-realtime      Reports allocations and locks inside processBlock\n"
+                     "  --run-tests           Runs the regression tests instead of rendering\n"
+                     "  --help                Shows this message\n";
+    }
+
+    int runTests()
+    {
+        juce::UnitTestRunner runner;
+        runner.setAssertOnFailure(false);
+        runner.runTestsInCategory("Quacker");
+
+        int failures = 0;
+
+        for (int i = 0; i < runner.getNumResults(); ++i)
+            failures += runner.getResult(i)->failures;
+
+        return failures > 0 ? 1 : 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    BatchRenderer::Settings settings;
+    settings.outputDirectory = juce::File::getCurrentWorkingDirectory().getChildFile("rendered");
+    juce::StringArray paths;
+    bool checkRealtime = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const juce::String arg(argv[i]);
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--help" || arg == "-h")
+        {
+            printUsage();
+            return 0;
+        }
+
+        if (arg == "--run-tests")
+            return runTests();
+
+        if (arg == "--check-realtime")
+        {
+            checkRealtime = true;
+            continue;
+        }
+
+        if (arg.startsWith("--") && !hasValue)
+        {
+            std::cerr << "Missing value for " << arg << "\n";
+            return 1;
+        }
+
+        if (arg == "--preset")              settings.preset = argv[++i];
+        else if (arg == "--output")         settings.outputDirectory = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        else if (arg == "--threads")        settings.numThreads = juce::String(argv[++i]).getIntValue();
+        else if (arg == "--block-size")     settings.blockSize = juce::String(argv[++i]).getIntValue();
+        else if (arg == "--bpm")            settings.bpm = juce::String(argv[++i]).getDoubleValue();
+        else if (arg == "--bits")           settings.bitDepth = juce::String(argv[++i]).getIntValue();
+        else if (arg.startsWith("--"))
+        {
+            std::cerr << "Unknown option " << arg << "\n";
+            return 1;
+        }
+        else
+        {
+            paths.add(arg);
+        }
+    }
+
+    if (settings.preset.isEmpty() || paths.isEmpty())
+    {
+        printUsage();
+        return 1;
+    }
+
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+    const auto inputs = BatchRenderer::collectInputs(paths, formats);
+
+    if (inputs.empty())
+    {
+        std::cerr << "No audio files found\n";
+        return 1;
+    }
+
+    // Off for plain renders, so the checks don't skew the throughput figure
+    RealtimeSafetyChecker::setEnabled(checkRealtime);
+
+    BatchRenderer renderer(settings);
+
+    const auto result = renderer.render(inputs, [](const BatchRenderer::Progress& progress)
+    {
+        std::cout << "\r" << (progress.filesDone + progress.filesFailed) << "/" << progress.totalFiles
+                  << " files, " << juce::String(progress.getRealtimeMultiple(), 1) << "x realtime" << std::flush;
+    });
+
+    std::cout << "\n";
+
+    if (renderer.getLastErrorMessage().isNotEmpty())
+    {
+        std::cerr << renderer.getLastErrorMessage() << "\n";
+        return 1;
+    }
+
+    for (const auto& failure : renderer.getFailures())
+        std::cerr << "Failed: " << failure << "\n";
+
+    std::cout << "Rendered " << result.filesDone << " of " << result.totalFiles << " files ("
+              << juce::String(result.audioSeconds, 1) << "s of audio in "
+              << juce::String(result.wallSeconds, 1) << "s, "
+              << juce::String(result.getRealtimeMultiple(), 1) << "x realtime)\n";
+
+    if (checkRealtime)
+    {
+        const auto violations = RealtimeSafetyChecker::getReport();
+
+        for (const auto& violation : violations)
+        {
+            std::cout << "\nRealtime violation: " << RealtimeSafetyChecker::getViolationName(violation.type);
+
+            if (violation.context.isNotEmpty())
+                std::cout << " (" << violation.context << ")";
+
+            std::cout << ", " << violation.count << " times\n" << violation.stack;
+        }
+
+        std::cout << RealtimeSafetyChecker::getNumViolations() << " realtime violations in "
+                  << violations.size() << " places\n";
+
+        if (RealtimeSafetyChecker::getNumViolations() > 0)
+            return 1;
+    }
+
+    return result.filesFailed > 0 ? 1 : 0;
+}
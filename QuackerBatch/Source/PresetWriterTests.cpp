@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    PresetWriterTests.cpp
+    Created: 19 Oct 2026 8:14:07pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../QuackerVST/Source/PresetWriter.h"
+
+namespace {
+    constexpr int TIMEOUT_MS = 5000;
+
+    std::unique_ptr<juce::XmlElement> makePreset(const juce::String& name) {
+        auto xml = std::make_unique<juce::XmlElement>("Preset");
+        xml->setAttribute("name", name);
+        return xml;
+    }
+
+    juce::String readName(const juce::File& file) {
+        auto xml = juce::XmlDocument::parse(file);
+        return xml != nullptr ? xml->getStringAttribute("name") : juce::String();
+    }
+}
+
+/**
+ * The background preset writer, flushed with waitUntilIdle so every check
+ * reads what actually reached the disk.
+ */
+class PresetWriterTests : public juce::UnitTest {
+public:
+    PresetWriterTests() : juce::UnitTest("Preset writer", "Quacker") {}
+
+    void runTest() override {
+        const auto directory = juce::File::createTempFile("QuackerPresetWriter");
+        directory.createDirectory();
+
+        beginTest("Queued presets are on disk once the writer is idle");
+        {
+            PresetWriter writer;
+            const auto first = directory.getChildFile("First.xml");
+            const auto second = directory.getChildFile("Second.xml");
+
+            writer.enqueue(first, makePreset("First"));
+            writer.enqueue(second, makePreset("Second"));
+
+            expect(writer.waitUntilIdle(TIMEOUT_MS));
+            expect(writer.getPendingWrites().empty());
+            expectEquals(readName(first), juce::String("First"));
+            expectEquals(readName(second), juce::String("Second"));
+        }
+
+        beginTest("The newest save of a file wins");
+        {
+            PresetWriter writer;
+            const auto file = directory.getChildFile("Repeated.xml");
+
+            for (int save = 1; save <= 20; ++save) {
+                writer.enqueue(file, makePreset("Save " + juce::String(save)));
+            }
+
+            expect(writer.waitUntilIdle(TIMEOUT_MS));
+            expectEquals(readName(file), juce::String("Save 20"));
+        }
+
+        beginTest("An idle writer doesn't block");
+        {
+            PresetWriter writer;
+            expect(writer.waitUntilIdle(0));
+        }
+
+        beginTest("A failed write is reported and doesn't stall the queue");
+        {
+            PresetWriter writer;
+            const auto unwritable = directory.getChildFile("Missing").getChildFile("Folder").getChildFile("Lost.xml");
+            const auto file = directory.getChildFile("After.xml");
+
+            writer.enqueue(unwritable, makePreset("Lost"));
+            writer.enqueue(file, makePreset("After"));
+
+            expect(writer.waitUntilIdle(TIMEOUT_MS));
+            expect(!unwritable.existsAsFile());
+            expectEquals(readName(file), juce::String("After"));
+        }
+
+        directory.deleteRecursively();
+    }
+};
+
+static PresetWriterTests presetWriterTests;
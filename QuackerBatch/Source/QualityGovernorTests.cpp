@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+    QualityGovernorTests.cpp
+    Created: 19 Oct 2026 7:02:51pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../QuackerVST/Source/QualityGovernor.h"
+
+namespace {
+    constexpr double SAMPLE_RATE = 48000.0;
+    constexpr int BLOCK_SIZE = 512;
+    constexpr double BLOCK_SECONDS = BLOCK_SIZE / SAMPLE_RATE;
+}
+
+/**
+ * Feeds the governor synthetic block timings, as shares of the real-time
+ * budget, and checks which tier it settles on.
+ */
+class QualityGovernorTests : public juce::UnitTest {
+public:
+    QualityGovernorTests() : juce::UnitTest("Quality governor", "Quacker") {}
+
+    void runTest() override {
+        using Tier = QualityGovernor::Tier;
+
+        beginTest("A light, steady load stays at Standard");
+        {
+            QualityGovernor governor;
+            governor.prepare(SAMPLE_RATE);
+            feed(governor, 10.0, 0.01f);
+            expect(governor.getTier() == Tier::Standard);
+        }
+
+        beginTest("A sustained load of a tenth of the budget steps down a tier at a time");
+        {
+            QualityGovernor governor;
+            governor.prepare(SAMPLE_RATE);
+            feed(governor, 0.6, 0.1f);
+            expect(governor.getTier() == Tier::Reduced);
+            feed(governor, 0.6, 0.1f);
+            expect(governor.getTier() == Tier::Economy);
+            feed(governor, 2.0, 0.1f);
+            expect(governor.getTier() == Tier::Economy, "Economy is the floor");
+        }
+
+        beginTest("Spikes over a light average step down");
+        {
+            QualityGovernor governor;
+            governor.prepare(SAMPLE_RATE);
+            feed(governor, 2.0, 0.01f);
+
+            // A preempted audio thread: most blocks are cheap, every tenth one takes a fifth of the budget
+            for (int block = 0; block < 100; ++block) {
+                governor.addMeasurement((block % 10 == 9 ? 0.2 : 0.01) * BLOCK_SECONDS, BLOCK_SIZE);
+            }
+
+            expect(governor.getLoad() < QualityGovernor::STEP_DOWN_LOAD, "The average alone stays under the threshold");
+            expect(governor.getTier() < Tier::Standard);
+        }
+
+        beginTest("A single spike is tolerated");
+        {
+            QualityGovernor governor;
+            governor.prepare(SAMPLE_RATE);
+            feed(governor, 2.0, 0.01f);
+            governor.addMeasurement(0.5 * BLOCK_SECONDS, BLOCK_SIZE);
+            feed(governor, 2.0, 0.01f);
+            expect(governor.getTier() == Tier::Standard);
+        }
+
+        beginTest("Recovery climbs back to Standard, and no higher");
+        {
+            QualityGovernor governor;
+            governor.prepare(SAMPLE_RATE);
+            feed(governor, 1.2, 0.1f);
+            expect(governor.getTier() == Tier::Economy);
+
+            feed(governor, 1.0, 0.01f);
+            expect(governor.getTier() == Tier::Economy, "Stepping up waits for a couple of quiet seconds");
+
+            feed(governor, 10.0, 0.01f);
+            expect(governor.getTier() == Tier::Standard);
+        }
+
+        beginTest("Offline renders run at Maximum whatever the load");
+        {
+            QualityGovernor governor;
+            governor.prepare(SAMPLE_RATE);
+            governor.setNonRealtime(true);
+            feed(governor, 2.0, 0.5f);
+            expect(governor.getTier() == Tier::Maximum);
+        }
+    }
+
+private:
+    // Blocks for the given stretch of audio, each taking `load` of its budget
+    static void feed(QualityGovernor& governor, double seconds, float load) {
+        for (double elapsed = 0.0; elapsed < seconds; elapsed += BLOCK_SECONDS) {
+            governor.addMeasurement(load * BLOCK_SECONDS, BLOCK_SIZE);
+        }
+    }
+};
+
+static QualityGovernorTests qualityGovernorTests;
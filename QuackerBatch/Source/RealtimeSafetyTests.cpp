@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    RealtimeSafetyTests.cpp
+    Created: 19 Oct 2026 6:12:40pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../QuackerVST/Source/PluginProcessor.h"
+
+namespace {
+    constexpr double SAMPLE_RATE = 44100.0;
+    constexpr int BLOCK_SIZE = 256;
+    constexpr int NUM_BLOCKS = 400;     // About 2.3 seconds per mode
+
+    void setParameter(QuackerVSTAudioProcessor& processor, const char* parameterID, float value) {
+        if (auto* parameter = processor.apvts.getParameter(parameterID)) {
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+        }
+    }
+
+    void fillWithSine(juce::AudioBuffer<float>& buffer, double& phase) {
+        const double increment = juce::MathConstants<double>::twoPi * 220.0 / SAMPLE_RATE;
+
+        for (int i = 0; i < buffer.getNumSamples(); ++i) {
+            const auto sample = static_cast<float>(0.5 * std::sin(phase));
+            phase += increment;
+
+            for (int channel = 0; channel < buffer.getNumChannels(); ++channel) {
+                buffer.setSample(channel, i, sample);
+            }
+        }
+    }
+}
+
+/**
+ * Regression render for the realtime-safety checker: every LFO mode runs
+ * through processBlock with checks on, and any allocation or checked lock
+ * taken on the audio thread fails the test with its call stack. Parameters
+ * move between blocks, so the morph, the spread and the audio-rate
+ * oversampling switch are all exercised.
+ */
+class RealtimeSafetyTests : public juce::UnitTest {
+public:
+    RealtimeSafetyTests() : juce::UnitTest("Realtime safety", "Quacker") {}
+
+    void runTest() override {
+        const bool wasEnabled = RealtimeSafetyChecker::isEnabled();
+        RealtimeSafetyChecker::setEnabled(true);
+
+        const juce::StringArray modes{ "Tremolo", "Auto-Pan", "Harmonic", "AM", "Ring Mod", "Pattern" };
+
+        for (int mode = 0; mode < modes.size(); ++mode) {
+            beginTest(modes[mode] + " renders without allocating or locking");
+            RealtimeSafetyChecker::clearReport();
+            renderMode(mode);
+            expectEquals(RealtimeSafetyChecker::getNumViolations(), 0);
+            logViolations();
+        }
+
+        beginTest("Growing the LFO buffers on the audio thread is reported");
+        RealtimeSafetyChecker::clearReport();
+
+        {
+            QuackerVSTAudioProcessor processor;
+            processor.setRateAndBufferSizeDetails(SAMPLE_RATE, BLOCK_SIZE);
+            processor.prepareToPlay(SAMPLE_RATE, BLOCK_SIZE);
+
+            // A host that sends more than it promised in prepareToPlay
+            juce::AudioBuffer<float> buffer(2, BLOCK_SIZE * 4);
+            juce::MidiBuffer midi;
+            double phase = 0.0;
+            fillWithSine(buffer, phase);
+            processor.processBlock(buffer, midi);
+            processor.releaseResources();
+        }
+
+        bool reported = false;
+
+        for (const auto& violation : RealtimeSafetyChecker::getReport()) {
+            reported = reported || (violation.type == RealtimeSafetyChecker::Violation::Allocation
+                                    && violation.context == "LFO buffers");
+        }
+
+        expect(reported, "The HeapBlock growth in allocateLFOBuffer went unreported");
+
+        RealtimeSafetyChecker::clearReport();
+        RealtimeSafetyChecker::setEnabled(wasEnabled);
+    }
+
+private:
+    void renderMode(int mode) {
+        QuackerVSTAudioProcessor processor;
+        processor.setRateAndBufferSizeDetails(SAMPLE_RATE, BLOCK_SIZE);
+        processor.prepareToPlay(SAMPLE_RATE, BLOCK_SIZE);
+
+        setParameter(processor, "lfoMode", static_cast<float>(mode));
+        setParameter(processor, "lfoDepth", 1.0f);
+        setParameter(processor, "lfoRate", 6.0f);
+        setParameter(processor, "channelSpread", 90.0f);
+        setParameter(processor, "lfoMorph", 1.0f);
+
+        juce::AudioBuffer<float> buffer(2, BLOCK_SIZE);
+        juce::MidiBuffer midi;
+        double phase = 0.0;
+
+        for (int block = 0; block < NUM_BLOCKS; ++block) {
+            // Sweep the shape across every waveform, and the AM rate back and forth over the oversampling threshold
+            setParameter(processor, "lfoShape", TremoloLFO::MAX_MORPH_POSITION * static_cast<float>(block % 100) / 100.0f);
+            setParameter(processor, "amFrequency", (block / 20) % 2 == 0 ? 500.0f : 2000.0f);
+
+            fillWithSine(buffer, phase);
+            processor.processBlock(buffer, midi);
+        }
+
+        processor.releaseResources();
+    }
+
+    void logViolations() {
+        for (const auto& violation : RealtimeSafetyChecker::getReport()) {
+            logMessage("Realtime violation: " + RealtimeSafetyChecker::getViolationName(violation.type)
+                       + (violation.context.isNotEmpty() ? " (" + violation.context + ")" : juce::String())
+                       + ", " + juce::String(violation.count) + " times\n" + violation.stack);
+        }
+    }
+};
+
+static RealtimeSafetyTests realtimeSafetyTests;
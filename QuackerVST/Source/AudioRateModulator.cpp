@@ -0,0 +1,330 @@
+/*
+  ==============================================================================
+
+    AudioRateModulator.cpp
+    Created: 18 Oct 2026 10:21:54pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "AudioRateModulator.h"
+#include "LFOBank.h"
+
+namespace {
+    constexpr int FFT_ORDER = 11;
+    constexpr int TABLE_SIZE = 1 << FFT_ORDER;
+    constexpr int TABLE_STRIDE = TABLE_SIZE + 1;   // Guard point so interpolation never wraps
+    constexpr int NUM_LEVELS = FFT_ORDER;          // TABLE_SIZE / 2 harmonics down to 1
+    constexpr int CHUNK_SIZE = 64;
+    constexpr double DEPTH_RAMP_SECONDS = 0.02;
+    constexpr double CROSSFADE_SECONDS = 0.005;
+
+    // Every built-in waveform; Custom comes last in the enum and has no band-limited tables
+    constexpr int NUM_SHAPES = TremoloLFO::Custom;
+    static_assert(NUM_SHAPES == TremoloLFO::NumWaveforms - 1, "Custom must be the last waveform");
+
+    // Lowest mip level whose highest harmonic stays under Nyquist at this frequency
+    int getMipLevel(double renderSampleRate, double frequency) noexcept {
+        double allowedHarmonics = 0.5 * renderSampleRate / juce::jmax(1.0, frequency);
+        int level = 0;
+
+        while (level < NUM_LEVELS - 1 && ((TABLE_SIZE / 2) >> level) > allowedHarmonics) {
+            ++level;
+        }
+
+        return level;
+    }
+}
+
+// Every built-in waveform at every mip level, band-limited by zeroing harmonics in the spectrum
+struct AudioRateModulator::MipmapTables {
+    MipmapTables() {
+        data.resize(static_cast<size_t>(NUM_SHAPES) * NUM_LEVELS * TABLE_STRIDE);
+
+        juce::dsp::FFT fft(FFT_ORDER);
+        std::vector<float> spectrum(2 * TABLE_SIZE);
+        std::vector<float> work(2 * TABLE_SIZE);
+
+        for (int shape = 0; shape < NUM_SHAPES; ++shape) {
+            const float* source = LFOBank::getWaveformTable(static_cast<TremoloLFO::Waveform>(shape));
+
+            std::fill(spectrum.begin(), spectrum.end(), 0.0f);
+            std::copy(source, source + TABLE_SIZE, spectrum.begin());
+            fft.performRealOnlyForwardTransform(spectrum.data());
+
+            for (int level = 0; level < NUM_LEVELS; ++level) {
+                const int maxHarmonic = (TABLE_SIZE / 2) >> level;
+                work = spectrum;
+
+                // Clear both the bin and its mirror above the cutoff
+                for (int bin = maxHarmonic + 1; bin < TABLE_SIZE - maxHarmonic; ++bin) {
+                    work[static_cast<size_t>(2 * bin)] = 0.0f;
+                    work[static_cast<size_t>(2 * bin + 1)] = 0.0f;
+                }
+
+                fft.performRealOnlyInverseTransform(work.data());
+
+                float* table = data.data() + (static_cast<size_t>(shape) * NUM_LEVELS + level) * TABLE_STRIDE;
+                std::copy(work.begin(), work.begin() + TABLE_SIZE, table);
+                table[TABLE_SIZE] = table[0];
+            }
+        }
+    }
+
+    const float* getTable(TremoloLFO::Waveform shape, int level) const noexcept {
+        jassert(shape < NUM_SHAPES);
+        return data.data() + (static_cast<size_t>(shape) * NUM_LEVELS + static_cast<size_t>(level)) * TABLE_STRIDE;
+    }
+
+    std::vector<float> data;
+};
+
+AudioRateModulator::AudioRateModulator() {
+    // Build or share the tables here rather than on the first audio callback
+    mipmaps = sharedResources->get<MipmapTables>({ "audioRateMipmaps" }, [] { return MipmapTables(); });
+    directDepth.reset(sampleRate, DEPTH_RAMP_SECONDS);
+    oversampledDepth.reset(sampleRate * (1 << OVERSAMPLING_ORDER), DEPTH_RAMP_SECONDS);
+}
+
+void AudioRateModulator::prepare(double newSampleRate, int maximumBlockSize, int newNumChannels) {
+    sampleRate = newSampleRate;
+    numChannels = juce::jmax(1, newNumChannels);
+    maxBlockSize = static_cast<size_t>(juce::jmax(1, maximumBlockSize));
+
+    // Linear phase with a whole-sample delay, so a delay line can match the direct path to it
+    oversampling = std::make_unique<juce::dsp::Oversampling<float>>(
+        static_cast<size_t>(numChannels), OVERSAMPLING_ORDER,
+        juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, false, true);
+    oversampling->initProcessing(maxBlockSize);
+    latency = juce::roundToInt(oversampling->getLatencyInSamples());
+
+    gainBufferSize = maxBlockSize << OVERSAMPLING_ORDER;
+    gainBuffer.allocate(gainBufferSize, true);
+    directBuffer.setSize(numChannels, static_cast<int>(maxBlockSize));
+    delayBuffer.setSize(numChannels, juce::jmax(1, latency));
+
+    directDepth.reset(sampleRate, DEPTH_RAMP_SECONDS);
+    oversampledDepth.reset(sampleRate * static_cast<double>(oversampling->getOversamplingFactor()), DEPTH_RAMP_SECONDS);
+    pathFade.reset(sampleRate, CROSSFADE_SECONDS);
+    reset();
+}
+
+void AudioRateModulator::reset() noexcept {
+    phase = 0.0;
+    directDepth.setCurrentAndTargetValue(directDepth.getTargetValue());
+    oversampledDepth.setCurrentAndTargetValue(directDepth.getTargetValue());
+
+    // Start on the direct path; the next block picks a side again
+    pathFade.setCurrentAndTargetValue(0.0f);
+    useOversampled = false;
+    oversamplerRunning = false;
+
+    delayBuffer.clear();
+    delayPosition = 0;
+
+    if (oversampling != nullptr) {
+        oversampling->reset();
+    }
+}
+
+void AudioRateModulator::setFrequency(float newFrequency) noexcept {
+    frequency = juce::jlimit(MIN_FREQUENCY, MAX_FREQUENCY, newFrequency);
+}
+
+void AudioRateModulator::setDepth(float newDepth) noexcept {
+    newDepth = juce::jlimit(0.0f, 1.0f, newDepth);
+    directDepth.setTargetValue(newDepth);
+    oversampledDepth.setTargetValue(newDepth);
+}
+
+void AudioRateModulator::setWaveform(TremoloLFO::Waveform newWaveform) noexcept {
+    // Custom has no mipmap, so it plays the sine the LFO falls back to without a table
+    waveform = newWaveform == TremoloLFO::Custom
+                   ? TremoloLFO::Sine
+                   : static_cast<TremoloLFO::Waveform>(juce::jlimit(0, NUM_SHAPES - 1, static_cast<int>(newWaveform)));
+}
+
+void AudioRateModulator::setMorph(bool shouldMorph, float position) noexcept {
+    morphing = shouldMorph && std::isfinite(position);
+
+    if (morphing) {
+        position = juce::jlimit(0.0f, static_cast<float>(NUM_SHAPES - 1), position);
+        const int lower = std::min(static_cast<int>(position), NUM_SHAPES - 2);
+        waveform = static_cast<TremoloLFO::Waveform>(lower);
+        morphTarget = static_cast<TremoloLFO::Waveform>(lower + 1);
+        morphBlend = position - static_cast<float>(lower);
+    }
+}
+
+void AudioRateModulator::process(juce::dsp::AudioBlock<float>& block, float mix) noexcept {
+    if (oversampling == nullptr || block.getNumChannels() > static_cast<size_t>(numChannels)) {
+        jassertfalse;   // Not prepared, or for fewer channels than this block has
+        return;
+    }
+
+    // Work in pieces if the host sends a bigger block than prepare() was told about
+    const size_t numSamples = block.getNumSamples();
+
+    for (size_t start = 0; start < numSamples; start += maxBlockSize) {
+        auto piece = block.getSubBlock(start, juce::jmin(maxBlockSize, numSamples - start));
+        processPiece(piece, mix);
+    }
+}
+
+void AudioRateModulator::processPiece(juce::dsp::AudioBlock<float>& block, float mix) noexcept {
+    const int numSamples = static_cast<int>(block.getNumSamples());
+    const int channels = static_cast<int>(block.getNumChannels());
+
+    if (frequency > OVERSAMPLING_THRESHOLD) {
+        useOversampled = true;
+    } else if (frequency < OVERSAMPLING_RELEASE) {
+        useOversampled = false;
+    }
+
+    // Run the oversampler through the hysteresis band and until a fade away from it ends
+    const bool needOversampler = useOversampled || frequency >= OVERSAMPLING_RELEASE || pathFade.getCurrentValue() > 0.0f;
+
+    if (needOversampler && !oversamplerRunning) {
+        oversampling->reset();
+    }
+
+    // A cold oversampler gets one block to fill its filters before it's faded in
+    const bool oversamplerWarm = oversamplerRunning;
+    oversamplerRunning = needOversampler;
+    pathFade.setTargetValue(useOversampled && oversamplerWarm ? 1.0f : 0.0f);
+
+    for (int channel = 0; channel < channels; ++channel) {
+        juce::FloatVectorOperations::copy(directBuffer.getWritePointer(channel), block.getChannelPointer(static_cast<size_t>(channel)), numSamples);
+    }
+
+    const double startPhase = phase;
+
+    if (oversamplerRunning) {
+        auto upsampled = oversampling->processSamplesUp(block);
+        const int upsampledSamples = static_cast<int>(upsampled.getNumSamples());
+        renderGains(gainBuffer, upsampledSamples, sampleRate * static_cast<double>(oversampling->getOversamplingFactor()),
+                    mix, startPhase, oversampledDepth);
+
+        for (size_t channel = 0; channel < upsampled.getNumChannels(); ++channel) {
+            juce::FloatVectorOperations::multiply(upsampled.getChannelPointer(channel), gainBuffer, upsampledSamples);
+        }
+
+        oversampling->processSamplesDown(block);
+    } else {
+        oversampledDepth.skip(numSamples << OVERSAMPLING_ORDER);
+    }
+
+    // The direct path always runs, so its delay line is current whenever it's faded back in.
+    // The oversampler delays the input by its whole latency but the gains only through the
+    // down stage, about half of it, so the direct gains lag by the same half.
+    delayDirectPath(channels, numSamples);
+    double directPhase = startPhase - static_cast<double>(frequency) * 0.5 * latency / sampleRate;
+    directPhase -= std::floor(directPhase);
+    renderGains(gainBuffer, numSamples, sampleRate, mix, directPhase, directDepth);
+
+    for (int channel = 0; channel < channels; ++channel) {
+        juce::FloatVectorOperations::multiply(directBuffer.getWritePointer(channel), gainBuffer, numSamples);
+    }
+
+    if (!oversamplerRunning || (!pathFade.isSmoothing() && pathFade.getTargetValue() == 0.0f)) {
+        for (int channel = 0; channel < channels; ++channel) {
+            juce::FloatVectorOperations::copy(block.getChannelPointer(static_cast<size_t>(channel)), directBuffer.getReadPointer(channel), numSamples);
+        }
+    } else if (pathFade.isSmoothing()) {
+        for (int i = 0; i < numSamples; ++i) {
+            gainBuffer[i] = pathFade.getNextValue();
+        }
+
+        for (int channel = 0; channel < channels; ++channel) {
+            float* output = block.getChannelPointer(static_cast<size_t>(channel));
+            const float* direct = directBuffer.getReadPointer(channel);
+
+            for (int i = 0; i < numSamples; ++i) {
+                output[i] = direct[i] + gainBuffer[i] * (output[i] - direct[i]);
+            }
+        }
+    }
+    // Otherwise the fade has settled on the oversampled path, which is already in the block
+
+    phase = std::fmod(startPhase + static_cast<double>(frequency) * numSamples / sampleRate, 1.0);
+}
+
+void AudioRateModulator::delayDirectPath(int channels, int numSamples) noexcept {
+    if (latency == 0) {
+        return;
+    }
+
+    int position = delayPosition;
+
+    for (int channel = 0; channel < channels; ++channel) {
+        float* samples = directBuffer.getWritePointer(channel);
+        float* line = delayBuffer.getWritePointer(channel);
+        position = delayPosition;
+
+        for (int i = 0; i < numSamples; ++i) {
+            const float delayed = line[position];
+            line[position] = samples[i];
+            samples[i] = delayed;
+
+            if (++position == latency) {
+                position = 0;
+            }
+        }
+    }
+
+    delayPosition = position;
+}
+
+void AudioRateModulator::renderGains(float* gains, int numSamples, double renderSampleRate, float mix,
+                                     double renderPhase, juce::SmoothedValue<float>& depthRamp) noexcept {
+    const int mipLevel = getMipLevel(renderSampleRate, frequency);
+    const float* table = mipmaps->getTable(waveform, mipLevel);
+
+    // Both sides of a morph come from the same mip level, so the crossfade stays band-limited
+    const float* morphTable = morphing ? mipmaps->getTable(morphTarget, mipLevel) : nullptr;
+    const double increment = frequency / renderSampleRate;
+
+    // Unipolar for AM, bipolar for ring mod
+    const float shapeScale = ringMod ? 2.0f : 1.0f;
+    const float shapeOffset = ringMod ? -1.0f : 0.0f;
+
+    alignas(32) juce::int32 index[CHUNK_SIZE];
+    alignas(32) float fraction[CHUNK_SIZE], shape[CHUNK_SIZE], depth[CHUNK_SIZE];
+
+    for (int start = 0; start < numSamples; start += CHUNK_SIZE) {
+        const int count = std::min(CHUNK_SIZE, numSamples - start);
+
+        // The running phase stays in double; within a chunk a float offset is exact enough
+        const auto startPhase = static_cast<float>(renderPhase);
+        const auto step = static_cast<float>(increment);
+
+        for (int i = 0; i < count; ++i) {
+            float position = FastMath::wrapPhase(startPhase + step * static_cast<float>(i)) * static_cast<float>(TABLE_SIZE);
+            index[i] = std::min(static_cast<juce::int32>(position), TABLE_SIZE - 1);
+            fraction[i] = position - static_cast<float>(index[i]);
+        }
+
+        for (int i = 0; i < count; ++i) {
+            shape[i] = table[index[i]] + fraction[i] * (table[index[i] + 1] - table[index[i]]);
+            depth[i] = depthRamp.getNextValue();
+        }
+
+        if (morphTable != nullptr) {
+            for (int i = 0; i < count; ++i) {
+                float target = morphTable[index[i]] + fraction[i] * (morphTable[index[i] + 1] - morphTable[index[i]]);
+                shape[i] += morphBlend * (target - shape[i]);
+            }
+        }
+
+        float* output = gains + start;
+
+        for (int i = 0; i < count; ++i) {
+            float modulator = shape[i] * shapeScale + shapeOffset;
+            float gain = 1.0f - depth[i] + depth[i] * modulator;
+            output[i] = 1.0f - mix + mix * gain;
+        }
+
+        renderPhase = std::fmod(renderPhase + increment * count, 1.0);
+    }
+}
@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    AudioRateModulator.h
+    Created: 18 Oct 2026 10:21:54pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "TremoloLFO.h"
+#include "SharedResourceCache.h"
+
+/**
+ * Amplitude and ring modulation at audio rates, well past TremoloLFO's 25 Hz ceiling.
+ *
+ * The modulator reads band-limited versions of the LFO waveforms from a
+ * shared mipmap, so each octave of frequency drops the harmonics that would
+ * alias. Above OVERSAMPLING_THRESHOLD the gain stage runs inside a
+ * juce::dsp::Oversampling block to keep the sidebands below Nyquist. None of
+ * this runs in the ordinary tremolo modes.
+ *
+ * The direct path is modulated at the base rate and then delayed by the
+ * oversampler's latency, so both paths line up sample for sample and the
+ * modulator always reports that latency. Moving between them crossfades
+ * over a few milliseconds. The switch has hysteresis, and the oversampler
+ * keeps running through the hysteresis band, so its filters are already
+ * settled when it's faded in.
+ *
+ * The drawn Custom shape has no mipmap, since it changes while playing and
+ * band-limiting it is an FFT per level. Custom plays as Sine here, and a
+ * morph stops at Slow Gear instead of fading into it.
+ */
+class AudioRateModulator {
+public:
+    AudioRateModulator();
+    ~AudioRateModulator() = default;
+
+    // Allocates the oversampler, gain and delay buffers; call from prepareToPlay
+    void prepare(double newSampleRate, int maximumBlockSize, int newNumChannels);
+    void reset() noexcept;
+
+    // Delay of both paths in samples, valid after prepare(); the host should compensate for it
+    int getLatencySamples() const noexcept { return latency; }
+
+    void setFrequency(float newFrequency) noexcept;
+    void setDepth(float newDepth) noexcept;
+    void setWaveform(TremoloLFO::Waveform newWaveform) noexcept;
+
+    // Crossfades the two waveforms either side of position, as the LFO's morph does; overrides setWaveform.
+    // Positions past Slow Gear hold it, since Custom isn't available here.
+    void setMorph(bool shouldMorph, float position) noexcept;
+
+    // Ring mod swings the gain bipolar, so full depth removes the carrier
+    void setRingMod(bool shouldRingMod) noexcept { ringMod = shouldRingMod; }
+
+    // Whether the oversampled path is selected; the output may still be crossfading towards it
+    bool isOversampling() const noexcept { return useOversampled; }
+
+    // Modulates the block in place; the dry mix is folded into the gain, so no dry copy is needed
+    void process(juce::dsp::AudioBlock<float>& block, float mix) noexcept;
+
+    static constexpr float MIN_FREQUENCY = 20.0f;
+    static constexpr float MAX_FREQUENCY = 5000.0f;
+    static constexpr float OVERSAMPLING_THRESHOLD = 1000.0f;
+    static constexpr float OVERSAMPLING_RELEASE = 800.0f;  // Back to the direct path below this
+
+private:
+    void processPiece(juce::dsp::AudioBlock<float>& block, float mix) noexcept;
+    void renderGains(float* gains, int numSamples, double renderSampleRate, float mix,
+                     double renderPhase, juce::SmoothedValue<float>& depthRamp) noexcept;
+    void delayDirectPath(int channels, int numSamples) noexcept;
+
+    // Band-limited tables for every waveform, shared between instances through the resource cache
+    struct MipmapTables;
+    juce::SharedResourcePointer<SharedResourceCache> sharedResources;
+    std::shared_ptr<const MipmapTables> mipmaps;
+
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversampling;
+    juce::HeapBlock<float> gainBuffer;
+    size_t gainBufferSize = 0;
+    size_t maxBlockSize = 0;
+
+    // The direct path's output, and the delay line that lines it up with the oversampler
+    juce::AudioBuffer<float> directBuffer;
+    juce::AudioBuffer<float> delayBuffer;
+    int delayPosition = 0;
+    int latency = 0;
+
+    TremoloLFO::Waveform waveform = TremoloLFO::Sine;
+    TremoloLFO::Waveform morphTarget = TremoloLFO::Sine;   // The upper waveform of the crossfade
+    float morphBlend = 0.0f;
+    bool morphing = false;
+
+    // One depth ramp per path, each stepped at the rate its gains are rendered at
+    juce::SmoothedValue<float> directDepth;
+    juce::SmoothedValue<float> oversampledDepth;
+
+    // 0 plays the direct path, 1 the oversampled one
+    juce::SmoothedValue<float> pathFade;
+    bool useOversampled = false;
+    bool oversamplerRunning = false;
+
+    double phase = 0.0;
+    double sampleRate = 44100.0;
+    float frequency = 440.0f;
+    bool ringMod = false;
+    int numChannels = 2;
+
+    static constexpr int OVERSAMPLING_ORDER = 2; // 4x
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioRateModulator)
+};
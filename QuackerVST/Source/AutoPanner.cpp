@@ -0,0 +1,108 @@
+/*
+  ==============================================================================
+
+    AutoPanner.cpp
+    Created: 18 Oct 2026 9:12:37pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "AutoPanner.h"
+
+namespace {
+    constexpr int PAN_TABLE_SIZE = 1024;
+    constexpr int CHUNK_SIZE = 64;
+
+    // sqrt(2) * cos over a quarter turn, plus a guard point. Read backwards it gives sqrt(2) * sin.
+    const float* getPanTable() {
+        static const std::vector<float> table = [] {
+            std::vector<float> values(PAN_TABLE_SIZE + 1);
+
+            for (int i = 0; i <= PAN_TABLE_SIZE; ++i) {
+                double angle = juce::MathConstants<double>::halfPi * i / PAN_TABLE_SIZE;
+                values[static_cast<size_t>(i)] = static_cast<float>(juce::MathConstants<double>::sqrt2 * std::cos(angle));
+            }
+
+            return values;
+        }();
+
+        return table.data();
+    }
+
+    inline float readTable(const float* table, juce::int32 index, float fraction) noexcept {
+        return table[index] + fraction * (table[index + 1] - table[index]);
+    }
+}
+
+AutoPanner::AutoPanner()
+    : panTable(getPanTable())
+{
+}
+
+void AutoPanner::setWidth(float newWidth) noexcept {
+    width = juce::jlimit(0.0f, 1.0f, newWidth);
+}
+
+void AutoPanner::setStereoOffset(float offsetDegrees) noexcept {
+    offsetDegrees = juce::jlimit(-360.0f, 360.0f, offsetDegrees);
+    stereoOffset = FastMath::wrapPhase(offsetDegrees / 360.0f);
+}
+
+void AutoPanner::setWaveform(TremoloLFO::Waveform newWaveform) noexcept {
+    waveformTable = LFOBank::getWaveformTable(newWaveform);
+}
+
+void AutoPanner::process(const float* lfoPhases, const float* lfoDepths,
+                         float* leftGains, float* rightGains, int numSamples) const noexcept {
+    // Fixed-size chunks keep the scratch arrays on the stack
+    for (int start = 0; start < numSamples; start += CHUNK_SIZE) {
+        processChunk(lfoPhases + start, lfoDepths + start, leftGains + start, rightGains + start,
+                     std::min(CHUNK_SIZE, numSamples - start));
+    }
+}
+
+void AutoPanner::processChunk(const float* lfoPhases, const float* lfoDepths,
+                              float* leftGains, float* rightGains, int numSamples) const noexcept {
+    constexpr int TABLE_SIZE = LFOBank::TABLE_SIZE;
+    constexpr float HALF_PAN = 0.5f * static_cast<float>(PAN_TABLE_SIZE);
+
+    alignas(32) juce::int32 leftIndex[CHUNK_SIZE], rightIndex[CHUNK_SIZE];
+    alignas(32) float leftFraction[CHUNK_SIZE], rightFraction[CHUNK_SIZE];
+    alignas(32) float leftShape[CHUNK_SIZE], rightShape[CHUNK_SIZE];
+
+    // Waveform table positions for both sides
+    for (int i = 0; i < numSamples; ++i) {
+        float leftPosition = FastMath::wrapPhase(lfoPhases[i]) * static_cast<float>(TABLE_SIZE);
+        float rightPosition = FastMath::wrapPhase(lfoPhases[i] + stereoOffset) * static_cast<float>(TABLE_SIZE);
+
+        leftIndex[i] = std::min(static_cast<juce::int32>(leftPosition), TABLE_SIZE - 1);
+        rightIndex[i] = std::min(static_cast<juce::int32>(rightPosition), TABLE_SIZE - 1);
+        leftFraction[i] = leftPosition - static_cast<float>(leftIndex[i]);
+        rightFraction[i] = rightPosition - static_cast<float>(rightIndex[i]);
+    }
+
+    for (int i = 0; i < numSamples; ++i) {
+        leftShape[i] = readTable(waveformTable, leftIndex[i], leftFraction[i]);
+        rightShape[i] = readTable(waveformTable, rightIndex[i], rightFraction[i]);
+    }
+
+    // Map the 0-1 waveform to a pan position on the quarter-turn table, centred at half way.
+    // The right gain is sin, which is the same table read from the other end.
+    for (int i = 0; i < numSamples; ++i) {
+        float amount = HALF_PAN * width * lfoDepths[i];
+        float leftPan = HALF_PAN + amount * (2.0f * leftShape[i] - 1.0f);
+        float rightPan = HALF_PAN - amount * (2.0f * rightShape[i] - 1.0f);
+
+        // Width, depth and shape are all within 0-1, so positions never leave the table
+        leftIndex[i] = std::min(static_cast<juce::int32>(leftPan), PAN_TABLE_SIZE - 1);
+        rightIndex[i] = std::min(static_cast<juce::int32>(rightPan), PAN_TABLE_SIZE - 1);
+        leftFraction[i] = leftPan - static_cast<float>(leftIndex[i]);
+        rightFraction[i] = rightPan - static_cast<float>(rightIndex[i]);
+    }
+
+    for (int i = 0; i < numSamples; ++i) {
+        leftGains[i] = readTable(panTable, leftIndex[i], leftFraction[i]);
+        rightGains[i] = readTable(panTable, rightIndex[i], rightFraction[i]);
+    }
+}
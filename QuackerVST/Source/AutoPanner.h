@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+
+    AutoPanner.h
+    Created: 18 Oct 2026 9:12:37pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "LFOBank.h"
+
+/**
+ * Stereo auto-pan driven by the tremolo LFO's phase.
+ *
+ * The waveform moves the pan position and the left/right gains follow a
+ * constant-power law read from a shared quarter-cycle table, so there is
+ * no per-sample trig. The right channel reads the waveform at the stereo
+ * offset: at 0 degrees it's a plain pan, and at 180 degrees both sides
+ * move together like an ordinary tremolo. Gains are unity at the centre,
+ * so a depth of zero leaves the signal untouched.
+ */
+class AutoPanner {
+public:
+    AutoPanner();
+    ~AutoPanner() = default;
+
+    // Pan excursion at full depth, 0 (centre) to 1 (hard left to hard right)
+    void setWidth(float newWidth) noexcept;
+
+    // Phase of the right channel relative to the left, in degrees
+    void setStereoOffset(float offsetDegrees) noexcept;
+
+    void setWaveform(TremoloLFO::Waveform newWaveform) noexcept;
+    void setWaveformTable(const float* newTable) noexcept { waveformTable = newTable; }
+
+    // Fills the left and right gains from the LFO's per-sample phase and running depth
+    void process(const float* lfoPhases, const float* lfoDepths,
+                 float* leftGains, float* rightGains, int numSamples) const noexcept;
+
+private:
+    void processChunk(const float* lfoPhases, const float* lfoDepths,
+                      float* leftGains, float* rightGains, int numSamples) const noexcept;
+
+    const float* waveformTable = LFOBank::getWaveformTable(TremoloLFO::Sine);
+    const float* panTable = nullptr;
+    float width = 1.0f;
+    float stereoOffset = 0.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AutoPanner)
+};
@@ -0,0 +1,77 @@
+/*
+  ==============================================================================
+
+    ChannelPhaseSpread.cpp
+    Created: 18 Oct 2026 8:41:09pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "ChannelPhaseSpread.h"
+
+void ChannelPhaseSpread::setNumChannels(int newNumChannels) noexcept {
+    numChannels = juce::jlimit(1, MAX_CHANNELS, newNumChannels);
+    updateOffsets();
+}
+
+void ChannelPhaseSpread::setSpread(float spreadDegrees) noexcept {
+    spread = juce::jlimit(0.0f, 360.0f, spreadDegrees);
+    updateOffsets();
+}
+
+void ChannelPhaseSpread::setWaveform(TremoloLFO::Waveform newWaveform) noexcept {
+    table = LFOBank::getWaveformTable(newWaveform);
+}
+
+void ChannelPhaseSpread::updateOffsets() noexcept {
+    // A full 360 degrees puts the last channel one step short of wrapping back to the first
+    float step = spread / (360.0f * static_cast<float>(numChannels));
+
+    for (int channel = 0; channel < MAX_CHANNELS; ++channel) {
+        channelOffsets[channel] = channel < numChannels ? FastMath::wrapPhase(step * static_cast<float>(channel)) : 0.0f;
+    }
+}
+
+void ChannelPhaseSpread::process(const float* lfoValues, const float* lfoPhases, const float* lfoDepths,
+                                 float* const* gains, int numSamples) const noexcept {
+    constexpr int TABLE_SIZE = LFOBank::TABLE_SIZE;
+
+    alignas(32) float fraction[MAX_CHANNELS], lower[MAX_CHANNELS], upper[MAX_CHANNELS], gain[MAX_CHANNELS];
+    alignas(32) juce::int32 tableIndex[MAX_CHANNELS];
+
+    for (int sample = 0; sample < numSamples; ++sample) {
+        const float phase = lfoPhases[sample];
+
+        // Unshifted table value; channel 0 has no offset, so its gain is exactly the LFO output
+        float basePosition = FastMath::wrapPhase(phase) * static_cast<float>(TABLE_SIZE);
+        auto baseIndex = std::min(static_cast<juce::int32>(basePosition), TABLE_SIZE - 1);
+        float baseFraction = basePosition - static_cast<float>(baseIndex);
+        float baseValue = table[baseIndex] + baseFraction * (table[baseIndex + 1] - table[baseIndex]);
+
+        // Vectorized index maths, scalar table reads in their own loop, vectorized blend
+        for (int channel = 0; channel < MAX_CHANNELS; ++channel) {
+            float position = FastMath::wrapPhase(phase + channelOffsets[channel]) * static_cast<float>(TABLE_SIZE);
+            auto index = std::min(static_cast<juce::int32>(position), TABLE_SIZE - 1);
+            fraction[channel] = position - static_cast<float>(index);
+            tableIndex[channel] = index;
+        }
+
+        for (int channel = 0; channel < MAX_CHANNELS; ++channel) {
+            lower[channel] = table[tableIndex[channel]];
+            upper[channel] = table[tableIndex[channel] + 1];
+        }
+
+        const float value = lfoValues[sample];
+        const float depth = lfoDepths[sample];
+
+        for (int channel = 0; channel < MAX_CHANNELS; ++channel) {
+            float shifted = lower[channel] + fraction[channel] * (upper[channel] - lower[channel]);
+            gain[channel] = std::min(1.0f, std::max(0.0f, value + depth * (shifted - baseValue)));
+        }
+
+        for (int channel = 0; channel < numChannels; ++channel) {
+            gains[channel][sample] = gain[channel];
+        }
+    }
+}
@@ -0,0 +1,58 @@
+/*
+  ==============================================================================
+
+    ChannelPhaseSpread.h
+    Created: 18 Oct 2026 8:41:09pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "LFOBank.h"
+
+/**
+ * Turns the single tremolo LFO into per-channel gains with a phase offset
+ * per channel, so the tremolo rotates around a surround layout.
+ *
+ * Nothing here keeps its own phase. Each channel reads the shared waveform
+ * table at the LFO's phase plus that channel's offset, and the difference
+ * from the unshifted table value is added to the LFO's output. Waveshaping,
+ * depth smoothing and the reset fade therefore carry through to every
+ * channel. Channels are processed as SIMD lanes, one lane per channel.
+ */
+class ChannelPhaseSpread {
+public:
+    static constexpr int MAX_CHANNELS = 16;
+
+    ChannelPhaseSpread() = default;
+    ~ChannelPhaseSpread() = default;
+
+    void setNumChannels(int newNumChannels) noexcept;
+    int getNumChannels() const noexcept { return numChannels; }
+
+    // Total phase spread in degrees, divided evenly between the channels
+    void setSpread(float spreadDegrees) noexcept;
+    bool isSpreading() const noexcept { return spread != 0.0f && numChannels > 1; }
+
+    void setWaveform(TremoloLFO::Waveform newWaveform) noexcept;
+
+    // For shapes that aren't in LFOBank's shared tables, such as a compiled custom waveform
+    void setWaveformTable(const float* newTable) noexcept { table = newTable; }
+
+    // Computes gains[channel][sample] from the LFO's per-sample output, phase and running depth
+    void process(const float* lfoValues, const float* lfoPhases, const float* lfoDepths,
+                 float* const* gains, int numSamples) const noexcept;
+
+private:
+    void updateOffsets() noexcept;
+
+    alignas(32) float channelOffsets[MAX_CHANNELS] = {};
+
+    const float* table = LFOBank::getWaveformTable(TremoloLFO::Sine);
+    int numChannels = 2;
+    float spread = 0.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChannelPhaseSpread)
+};
@@ -11,6 +11,7 @@
 #pragma once
 #include <JuceHeader.h>
 #include "PerlinNoise.h"
+#include "SharedResourceCache.h"
 
 /**
  * A custom look and feel for popup menus that matches the style of the Quacker plugin UI.
@@ -20,9 +21,6 @@ class CustomMenuLookAndFeel : public juce::LookAndFeel_V4
     public:
     CustomMenuLookAndFeel()
     {
-        // Create the background image once
-        backgroundImage = createBackgroundImage(400, 400);
-        
         // Set colors for various components
         setColour(juce::PopupMenu::backgroundColourId, juce::Colours::black.withAlpha(0.92f));
         setColour(juce::PopupMenu::textColourId, juce::Colour(232, 193, 185)); // Rose gold
@@ -32,7 +30,9 @@ class CustomMenuLookAndFeel : public juce::LookAndFeel_V4
     }
     
     private:
-    juce::Image backgroundImage;
+    // One texture for every menu in every instance, made the first time any menu opens
+    juce::SharedResourcePointer<SharedResourceCache> sharedResources;
+    std::shared_ptr<const juce::Image> backgroundImage;
     
     void drawPopupMenuBackground(juce::Graphics& g, int width, int height) override
     {
@@ -40,13 +40,19 @@ class CustomMenuLookAndFeel : public juce::LookAndFeel_V4
         g.setColour(findColour(juce::PopupMenu::backgroundColourId));
         g.fillAll();
         
+        if (backgroundImage == nullptr)
+        {
+            backgroundImage = sharedResources->get<juce::Image>({ "menuBackground" },
+                                                                [] { return createBackgroundImage(400, 400); });
+        }
+        
         // Draw our background image with reduced opacity
-        if (!backgroundImage.isNull())
+        if (!backgroundImage->isNull())
         {
             g.setOpacity(0.6f);
-            g.drawImage(backgroundImage,
+            g.drawImage(*backgroundImage,
                         0, 0, width, height,
-                        0, 0, backgroundImage.getWidth(), backgroundImage.getHeight(),
+                        0, 0, backgroundImage->getWidth(), backgroundImage->getHeight(),
                         false);
         }
         
@@ -56,7 +62,7 @@ class CustomMenuLookAndFeel : public juce::LookAndFeel_V4
     }
     
     // Create a background image with matching style to the plugin
-    juce::Image createBackgroundImage(int width, int height)
+    static juce::Image createBackgroundImage(int width, int height)
     {
         juce::Image img(juce::Image::ARGB, width, height, true);
         juce::Graphics g(img);
@@ -0,0 +1,177 @@
+/*
+  ==============================================================================
+
+    CustomWaveform.cpp
+    Created: 19 Oct 2026 12:52:31am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "CustomWaveform.h"
+
+static_assert(CustomWaveform::TABLE_SIZE == TremoloLFO::CUSTOM_TABLE_SIZE,
+              "TremoloLFO reads custom tables at LFOBank's size");
+
+namespace {
+    constexpr int FFT_ORDER = 11;
+    constexpr int BYTES_PER_POINT = 3;
+
+    juce::uint8 toByte(float value) noexcept {
+        return static_cast<juce::uint8>(juce::jlimit(0, 255, juce::roundToInt(value * 255.0f)));
+    }
+}
+
+const juce::Identifier CustomWaveform::shapeType("Waveform");
+
+CustomWaveform::CustomWaveform()
+    : fft(FFT_ORDER),
+      fftBuffer(2 * TABLE_SIZE)
+{
+    static_assert((1 << FFT_ORDER) == TABLE_SIZE, "FFT must cover the whole table");
+
+    shape = getDefaultShape();
+
+    for (auto& table : tables) {
+        compile(shape, table);
+    }
+}
+
+CustomWaveform::Shape CustomWaveform::getDefaultShape() noexcept {
+    // A ramp up and a curved fall, so a fresh editor shows something to grab
+    Shape initial;
+    initial.numPoints = 3;
+    initial.points[0] = { 0.0f, 0.0f, 0.0f };
+    initial.points[1] = { 0.25f, 1.0f, 0.5f };
+    initial.points[2] = { 0.75f, 0.2f, -0.5f };
+    return initial;
+}
+
+void CustomWaveform::setShape(const Shape& newShape) {
+    // A second producer would race this one on writeIndex; without a message manager the caller is the only one
+    jassert(juce::MessageManager::getInstanceWithoutCreating() == nullptr
+            || juce::MessageManager::existsAndIsCurrentThread());
+
+    shape = newShape;
+    shape.numPoints = juce::jlimit(0, MAX_POINTS, shape.numPoints);
+
+    for (int i = 0; i < shape.numPoints; ++i) {
+        auto& point = shape.points[i];
+        point.x = juce::jlimit(0.0f, 1.0f, point.x);
+        point.y = juce::jlimit(0.0f, 1.0f, point.y);
+        point.curve = juce::jlimit(-1.0f, 1.0f, point.curve);
+    }
+
+    std::stable_sort(shape.points, shape.points + shape.numPoints,
+                     [](const Breakpoint& a, const Breakpoint& b) { return a.x < b.x; });
+
+    compile(shape, tables[writeIndex]);
+    writeIndex = middleIndex.exchange(writeIndex | FRESH_FLAG, std::memory_order_acq_rel) & 3;
+    ++version;
+}
+
+float CustomWaveform::evaluate(const Shape& source, float phase) noexcept {
+    if (source.numPoints == 0) {
+        return 0.5f;
+    }
+
+    if (source.numPoints == 1) {
+        return source.points[0].y;
+    }
+
+    // Last point at or before the phase; before the first point, the segment wraps from the last
+    int start = source.numPoints - 1;
+
+    for (int i = 0; i < source.numPoints; ++i) {
+        if (source.points[i].x <= phase) {
+            start = i;
+        }
+    }
+
+    const auto& from = source.points[start];
+    const auto& to = source.points[(start + 1) % source.numPoints];
+
+    float span = to.x - from.x;
+    float offset = phase - from.x;
+
+    if (span <= 0.0f) {
+        span += 1.0f;
+    }
+
+    if (offset < 0.0f) {
+        offset += 1.0f;
+    }
+
+    const float t = span > 0.0f ? juce::jlimit(0.0f, 1.0f, offset / span) : 0.0f;
+    const float bent = std::pow(t, std::exp2(3.0f * from.curve));
+    return from.y + (to.y - from.y) * bent;
+}
+
+void CustomWaveform::compile(const Shape& source, float* destination) {
+    std::fill(fftBuffer.begin(), fftBuffer.end(), 0.0f);
+
+    for (int i = 0; i < TABLE_SIZE; ++i) {
+        fftBuffer[static_cast<size_t>(i)] = evaluate(source, static_cast<float>(i) / static_cast<float>(TABLE_SIZE));
+    }
+
+    fft.performRealOnlyForwardTransform(fftBuffer.data());
+
+    // Clear both the bin and its mirror above the cutoff
+    for (int bin = MAX_HARMONIC + 1; bin < TABLE_SIZE - MAX_HARMONIC; ++bin) {
+        fftBuffer[static_cast<size_t>(2 * bin)] = 0.0f;
+        fftBuffer[static_cast<size_t>(2 * bin + 1)] = 0.0f;
+    }
+
+    fft.performRealOnlyInverseTransform(fftBuffer.data());
+
+    // Ringing from the band limit can overshoot the unipolar range
+    for (int i = 0; i < TABLE_SIZE; ++i) {
+        destination[i] = juce::jlimit(0.0f, 1.0f, fftBuffer[static_cast<size_t>(i)]);
+    }
+
+    destination[TABLE_SIZE] = destination[0];
+}
+
+const float* CustomWaveform::acquireTable() noexcept {
+    if (middleIndex.load(std::memory_order_acquire) & FRESH_FLAG) {
+        readIndex = middleIndex.exchange(readIndex, std::memory_order_acq_rel) & 3;
+    }
+
+    return tables[readIndex];
+}
+
+juce::ValueTree CustomWaveform::shapeToValueTree(const Shape& source) {
+    juce::MemoryBlock packed;
+    packed.ensureSize(static_cast<size_t>(source.numPoints * BYTES_PER_POINT));
+
+    for (int i = 0; i < source.numPoints; ++i) {
+        const auto& point = source.points[i];
+        const juce::uint8 bytes[BYTES_PER_POINT] = {
+            toByte(point.x), toByte(point.y), toByte((point.curve + 1.0f) * 0.5f)
+        };
+        packed.append(bytes, sizeof(bytes));
+    }
+
+    juce::ValueTree tree(shapeType);
+    tree.setProperty("points", packed.toBase64Encoding(), nullptr);
+    return tree;
+}
+
+CustomWaveform::Shape CustomWaveform::shapeFromValueTree(const juce::ValueTree& tree) {
+    juce::MemoryBlock packed;
+
+    if (!tree.isValid() || !tree.hasType(shapeType)
+        || !packed.fromBase64Encoding(tree.getProperty("points").toString())) {
+        return getDefaultShape();
+    }
+
+    Shape loaded;
+    loaded.numPoints = juce::jmin(MAX_POINTS, static_cast<int>(packed.getSize()) / BYTES_PER_POINT);
+
+    for (int i = 0; i < loaded.numPoints; ++i) {
+        const auto* bytes = static_cast<const juce::uint8*>(packed.getData()) + i * BYTES_PER_POINT;
+        loaded.points[i] = { bytes[0] / 255.0f, bytes[1] / 255.0f, bytes[2] / 255.0f * 2.0f - 1.0f };
+    }
+
+    return loaded.numPoints > 0 ? loaded : getDefaultShape();
+}
@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    CustomWaveform.h
+    Created: 19 Oct 2026 12:52:31am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "LFOBank.h"
+
+/**
+ * A user-drawn LFO shape, given as breakpoints joined by bendable curves.
+ *
+ * The shape is compiled on the message thread. The breakpoints are sampled
+ * into a table the size of LFOBank's, and the table is band-limited by
+ * zeroing its upper harmonics, so hard corners don't click at fast rates.
+ * A lock-free triple buffer hands the result to the audio thread. There
+ * the Custom waveform is one interpolated table read, like the built-in
+ * table shapes, and no curve is evaluated per sample.
+ */
+class CustomWaveform {
+public:
+    static constexpr int MAX_POINTS = 32;
+    static constexpr int TABLE_SIZE = LFOBank::TABLE_SIZE;
+    static constexpr int MAX_HARMONIC = 64;
+
+    struct Breakpoint {
+        float x = 0.0f;       // Position in the cycle, 0-1
+        float y = 0.0f;       // Unipolar level, 0-1
+        float curve = 0.0f;   // Bend of the segment leaving this point, -1 to 1
+    };
+
+    struct Shape {
+        int numPoints = 0;
+        Breakpoint points[MAX_POINTS];
+    };
+
+    CustomWaveform();
+    ~CustomWaveform() = default;
+
+    // Message thread only: sorts, compiles and publishes the shape. The triple buffer takes one
+    // producer, so state restores from host threads must be posted to the message thread.
+    void setShape(const Shape& newShape);
+
+    // Message thread only, for the same reason; the editor reads it while setShape may rewrite it
+    const Shape& getShape() const noexcept { return shape; }
+
+    // Bumped on every setShape, so editors can tell when a preset replaced the shape
+    juce::uint32 getVersion() const noexcept { return version.load(); }
+
+    static Shape getDefaultShape() noexcept;
+
+    // Level of the raw, un-band-limited shape at a phase; used for drawing and compiling
+    static float evaluate(const Shape& source, float phase) noexcept;
+
+    // Breakpoints are packed three bytes each and base64 encoded
+    static juce::ValueTree shapeToValueTree(const Shape& source);
+    static Shape shapeFromValueTree(const juce::ValueTree& tree);
+    static const juce::Identifier shapeType;
+
+    // Audio thread: the newest compiled table, TABLE_SIZE + 1 points, valid until the next call
+    const float* acquireTable() noexcept;
+
+private:
+    void compile(const Shape& source, float* destination);
+
+    juce::dsp::FFT fft;
+    std::vector<float> fftBuffer;
+
+    // Triple buffer, as in StepSequencer
+    float tables[3][TABLE_SIZE + 1] = {};
+    std::atomic<int> middleIndex{ 1 };
+    int writeIndex = 2;
+    int readIndex = 0;
+    static constexpr int FRESH_FLAG = 4;
+
+    Shape shape;
+    std::atomic<juce::uint32> version{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CustomWaveform)
+};
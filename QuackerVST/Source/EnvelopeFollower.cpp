@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+    EnvelopeFollower.cpp
+    Created: 18 Oct 2026 10:58:12pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "EnvelopeFollower.h"
+
+namespace {
+    constexpr int CHUNK_SIZE = 32;
+    constexpr float FLOOR_DB = -60.0f;
+    constexpr float ONSET_FLOOR = 1.0e-5f;       // Mean power below -50 dB never counts as an attack
+    constexpr double SLOW_AVERAGE_MS = 100.0;
+}
+
+void EnvelopeFollower::prepare(double newSampleRate) noexcept {
+    sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+    updateCoefficients();
+    reset();
+}
+
+void EnvelopeFollower::reset() noexcept {
+    envelope = 0.0f;
+    level = 0.0f;
+    slowPower = 0.0f;
+    samplesSinceOnset = refractorySamples;
+    numOnsets = 0;
+}
+
+void EnvelopeFollower::setAttack(float attackMs) noexcept {
+    attackMs = juce::jlimit(MIN_ATTACK_MS, MAX_ATTACK_MS, attackMs);
+
+    if (attackMs != attackTime) {
+        attackTime = attackMs;
+        updateCoefficients();
+    }
+}
+
+void EnvelopeFollower::setRelease(float releaseMs) noexcept {
+    releaseMs = juce::jlimit(MIN_RELEASE_MS, MAX_RELEASE_MS, releaseMs);
+
+    if (releaseMs != releaseTime) {
+        releaseTime = releaseMs;
+        updateCoefficients();
+    }
+}
+
+void EnvelopeFollower::setOnsetSensitivity(float newSensitivity) noexcept {
+    // 24 dB of power jump at zero sensitivity, 3 dB at full
+    const float ratioDb = 24.0f - 21.0f * juce::jlimit(0.0f, 1.0f, newSensitivity);
+    onsetRatio = std::pow(10.0f, ratioDb * 0.1f);
+}
+
+void EnvelopeFollower::setRefractoryPeriod(float refractoryMs) noexcept {
+    refractoryMs = juce::jlimit(MIN_REFRACTORY_MS, MAX_REFRACTORY_MS, refractoryMs);
+
+    if (refractoryMs != refractoryTime) {
+        refractoryTime = refractoryMs;
+        updateCoefficients();
+    }
+}
+
+void EnvelopeFollower::updateCoefficients() noexcept {
+    // The ballistics step once per chunk, so the time constants are in chunks
+    const double chunksPerMs = sampleRate * 0.001 / CHUNK_SIZE;
+
+    attackCoefficient = static_cast<float>(std::exp(-1.0 / (attackTime * chunksPerMs)));
+    releaseCoefficient = static_cast<float>(std::exp(-1.0 / (releaseTime * chunksPerMs)));
+    slowCoefficient = static_cast<float>(std::exp(-1.0 / (SLOW_AVERAGE_MS * chunksPerMs)));
+    refractorySamples = static_cast<int>(refractoryTime * 0.001 * sampleRate);
+}
+
+template <typename SampleType>
+float EnvelopeFollower::process(const SampleType* const* channels, int numChannels, int numSamples) noexcept {
+    alignas(32) float peak[CHUNK_SIZE];
+    alignas(32) float power[CHUNK_SIZE];
+
+    const bool rms = mode == Mode::RMS;
+    const float powerScale = 1.0f / static_cast<float>(juce::jmax(1, numChannels));
+    float blockPeak = 0.0f;
+    float env = envelope;
+    numOnsets = 0;
+
+    for (int start = 0; start < numSamples; start += CHUNK_SIZE) {
+        const int count = std::min(CHUNK_SIZE, numSamples - start);
+
+        std::fill(std::begin(peak), std::end(peak), 0.0f);
+        std::fill(std::begin(power), std::end(power), 0.0f);
+
+        for (int channel = 0; channel < numChannels; ++channel) {
+            const SampleType* x = channels[channel] + start;
+
+            for (int i = 0; i < count; ++i) {
+                const auto sample = static_cast<float>(x[i]);
+                peak[i] = std::max(peak[i], std::abs(sample));
+                power[i] += sample * sample;
+            }
+        }
+
+        float chunkPeak = 0.0f;
+        float chunkPower = 0.0f;
+
+        for (int i = 0; i < count; ++i) {
+            chunkPeak = std::max(chunkPeak, peak[i]);
+            chunkPower += power[i];
+        }
+
+        blockPeak = std::max(blockPeak, chunkPeak);
+
+        const float meanPower = chunkPower * powerScale / static_cast<float>(count);
+        const float onsetThreshold = slowPower * onsetRatio;
+
+        if (meanPower > onsetThreshold && meanPower > ONSET_FLOOR
+            && samplesSinceOnset >= refractorySamples && numOnsets < MAX_ONSETS) {
+            // Only chunks with an attack pay for the search
+            const float sampleThreshold = onsetThreshold / powerScale;
+            int position = 0;
+
+            while (position < count - 1 && power[position] <= sampleThreshold) {
+                ++position;
+            }
+
+            onsets[numOnsets++] = start + position;
+            samplesSinceOnset = count - position;
+        } else {
+            samplesSinceOnset = std::min(samplesSinceOnset + count, refractorySamples);
+        }
+
+        slowPower = meanPower + slowCoefficient * (slowPower - meanPower);
+
+        const float detector = rms ? std::sqrt(meanPower) : chunkPeak;
+        const float coefficient = detector > env ? attackCoefficient : releaseCoefficient;
+        env = detector + coefficient * (env - detector);
+    }
+
+    envelope = env;
+
+    const float db = juce::Decibels::gainToDecibels(envelope, FLOOR_DB);
+    level = juce::jlimit(0.0f, 1.0f, 1.0f - db / FLOOR_DB);
+
+    return blockPeak;
+}
+
+template float EnvelopeFollower::process<float>(const float* const*, int, int) noexcept;
+template float EnvelopeFollower::process<double>(const double* const*, int, int) noexcept;
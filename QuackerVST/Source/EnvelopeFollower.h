@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    EnvelopeFollower.h
+    Created: 18 Oct 2026 10:58:12pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+/**
+ * Tracks the input level so the tremolo can follow playing dynamics.
+ *
+ * One pass over the input feeds both this follower and the processor's
+ * silence gate. The pass keeps a per-sample peak and power across all
+ * channels in short SIMD chunks. Each chunk is then reduced to one
+ * detector value, and the attack/release ballistics run once per chunk
+ * instead of once per sample. The level is reported in 0..1 over a
+ * -60..0 dB range, which is what the depth and rate amounts scale.
+ *
+ * The same chunks drive an energy-ratio onset detector: a chunk whose mean
+ * power jumps above a slow running average by the sensitivity ratio counts
+ * as an attack. The onset is then placed on the first sample in that chunk
+ * that crosses the ratio, and a refractory period stops a single pick from
+ * triggering twice.
+ */
+class EnvelopeFollower {
+public:
+    enum class Mode {
+        Peak = 0,
+        RMS
+    };
+
+    EnvelopeFollower() = default;
+    ~EnvelopeFollower() = default;
+
+    void prepare(double newSampleRate) noexcept;
+    void reset() noexcept;
+
+    void setMode(Mode newMode) noexcept { mode = newMode; }
+    void setAttack(float attackMs) noexcept;
+    void setRelease(float releaseMs) noexcept;
+
+    // Runs the detector over the block and returns its absolute peak, for silence detection.
+    // Instantiated for float and double host buffers.
+    template <typename SampleType>
+    float process(const SampleType* const* channels, int numChannels, int numSamples) noexcept;
+
+    float getLevel() const noexcept { return level; }
+
+    // 0 needs a sharp attack, 1 triggers on softer playing
+    void setOnsetSensitivity(float newSensitivity) noexcept;
+    void setRefractoryPeriod(float refractoryMs) noexcept;
+
+    // Sample positions of the attacks found by the last process() call, in ascending order
+    int getNumOnsets() const noexcept { return numOnsets; }
+    int getOnset(int index) const noexcept { return onsets[index]; }
+
+    static constexpr int MAX_ONSETS = 16;
+    static constexpr float MIN_REFRACTORY_MS = 20.0f;
+    static constexpr float MAX_REFRACTORY_MS = 1000.0f;
+
+    static constexpr float MIN_ATTACK_MS = 1.0f;
+    static constexpr float MAX_ATTACK_MS = 200.0f;
+    static constexpr float MIN_RELEASE_MS = 10.0f;
+    static constexpr float MAX_RELEASE_MS = 2000.0f;
+
+private:
+    void updateCoefficients() noexcept;
+
+    double sampleRate = 44100.0;
+    Mode mode = Mode::Peak;
+    float attackTime = 10.0f;
+    float releaseTime = 150.0f;
+    float attackCoefficient = 0.0f;
+    float releaseCoefficient = 0.0f;
+    float envelope = 0.0f;  // Linear amplitude
+    float level = 0.0f;     // Normalised dB
+
+    float onsetRatio = 20.0f;
+    float slowCoefficient = 0.0f;
+    float slowPower = 0.0f;
+    float refractoryTime = 120.0f;
+    int refractorySamples = 0;
+    int samplesSinceOnset = 0;
+    int onsets[MAX_ONSETS] = {};
+    int numOnsets = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EnvelopeFollower)
+};
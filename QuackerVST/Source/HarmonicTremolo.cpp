@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+
+    HarmonicTremolo.cpp
+    Created: 18 Oct 2026 9:47:15pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "HarmonicTremolo.h"
+
+namespace {
+    constexpr int CHUNK_SIZE = 64;
+    constexpr float R2 = 1.41421356f;
+}
+
+void HarmonicTremolo::prepare(double newSampleRate, int newNumChannels) noexcept {
+    sampleRate = newSampleRate;
+    numChannels = juce::jlimit(1, MAX_CHANNELS, newNumChannels);
+    numLanes = juce::jmin(MAX_CHANNELS, (numChannels + 3) & ~3);
+
+    updateCoefficients();
+    reset();
+}
+
+void HarmonicTremolo::reset() noexcept {
+    std::fill(std::begin(s1), std::end(s1), 0.0f);
+    std::fill(std::begin(s2), std::end(s2), 0.0f);
+    std::fill(std::begin(s3), std::end(s3), 0.0f);
+    std::fill(std::begin(s4), std::end(s4), 0.0f);
+}
+
+void HarmonicTremolo::setCrossoverFrequency(float newFrequency) noexcept {
+    if (newFrequency != crossoverFrequency) {
+        crossoverFrequency = newFrequency;
+        updateCoefficients();
+    }
+}
+
+void HarmonicTremolo::updateCoefficients() noexcept {
+    // Keep the cutoff safely below Nyquist
+    double frequency = juce::jlimit(20.0, sampleRate * 0.45, static_cast<double>(crossoverFrequency));
+
+    g = static_cast<float>(std::tan(juce::MathConstants<double>::pi * frequency / sampleRate));
+    h = 1.0f / (1.0f + R2 * g + g * g);
+}
+
+template <typename SampleType>
+void HarmonicTremolo::process(SampleType* const* channels, int channelCount, const float* lfoGains,
+                              const float* lfoDepths, float mix, int numSamples) noexcept {
+    if (channelCount != numChannels) {
+        prepare(sampleRate, channelCount);
+    }
+
+    for (int start = 0; start < numSamples; start += CHUNK_SIZE) {
+        processChunk(channels, start, lfoGains + start, lfoDepths + start, mix,
+                     std::min(CHUNK_SIZE, numSamples - start));
+    }
+}
+
+template <typename SampleType>
+void HarmonicTremolo::processChunk(SampleType* const* channels, int offset, const float* lfoGains,
+                                   const float* lfoDepths, float mix, int numSamples) noexcept {
+    // Interleaved as [sample][lane]; lanes past numChannels stay silent
+    alignas(32) float frame[CHUNK_SIZE * MAX_CHANNELS] = {};
+
+    for (int channel = 0; channel < numChannels; ++channel) {
+        const SampleType* source = channels[channel] + offset;
+
+        for (int i = 0; i < numSamples; ++i) {
+            frame[i * MAX_CHANNELS + channel] = static_cast<float>(source[i]);
+        }
+    }
+
+    const float gain = g;
+    const float norm = h;
+    const float wet = mix;
+    const float dry = 1.0f - mix;
+
+    for (int i = 0; i < numSamples; ++i) {
+        float* x = frame + i * MAX_CHANNELS;
+
+        // The low band gets the tremolo gain, the high band its complement around the same depth
+        const float lowGain = lfoGains[i];
+        const float highGain = std::min(1.0f, std::max(0.0f, 2.0f - lfoDepths[i] - lowGain));
+
+        for (int lane = 0; lane < numLanes; ++lane) {
+            float input = x[lane];
+
+            // First Butterworth stage; its low output feeds the second stage
+            float yH = (input - (R2 + gain) * s1[lane] - s2[lane]) * norm;
+            float yB = gain * yH + s1[lane];
+            s1[lane] = gain * yH + yB;
+            float yL = gain * yB + s2[lane];
+            s2[lane] = gain * yB + yL;
+
+            float yH2 = (yL - (R2 + gain) * s3[lane] - s4[lane]) * norm;
+            float yB2 = gain * yH2 + s3[lane];
+            s3[lane] = gain * yH2 + yB2;
+            float low = gain * yB2 + s4[lane];
+            s4[lane] = gain * yB2 + low;
+
+            // High band as the first stage's allpass minus the low band, so the two sum flat
+            float high = yL - R2 * yB + yH - low;
+
+            x[lane] = (low * lowGain + high * highGain) * wet + input * dry;
+        }
+    }
+
+    for (int channel = 0; channel < numChannels; ++channel) {
+        SampleType* destination = channels[channel] + offset;
+
+        for (int i = 0; i < numSamples; ++i) {
+            destination[i] = static_cast<SampleType>(frame[i * MAX_CHANNELS + channel]);
+        }
+    }
+}
+
+template void HarmonicTremolo::process<float>(float* const*, int, const float*, const float*, float, int) noexcept;
+template void HarmonicTremolo::process<double>(double* const*, int, const float*, const float*, float, int) noexcept;
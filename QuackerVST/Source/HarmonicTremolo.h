@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    HarmonicTremolo.h
+    Created: 18 Oct 2026 9:47:15pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+/**
+ * Harmonic tremolo, as in brownface Fender and Magnatone amps.
+ *
+ * A 4th-order Linkwitz-Riley crossover splits the signal. The low band
+ * takes the tremolo gain and the high band takes its complement, so both
+ * are driven by one LFO evaluation and move in antiphase. The two LR bands
+ * sum flat, which means zero depth leaves the signal untouched.
+ *
+ * The crossover follows JUCE's TPT LinkwitzRileyFilter, but keeps its
+ * state as one SIMD lane per channel. Audio is interleaved in short
+ * chunks so every sample updates all channels in one vector operation.
+ */
+class HarmonicTremolo {
+public:
+    static constexpr int MAX_CHANNELS = 16;
+
+    HarmonicTremolo() = default;
+    ~HarmonicTremolo() = default;
+
+    void prepare(double newSampleRate, int newNumChannels) noexcept;
+    void reset() noexcept;
+    void setCrossoverFrequency(float newFrequency) noexcept;
+
+    // Splits, modulates and recombines the channels in place, mixing with the dry signal.
+    // Instantiated for float and double host buffers; the crossover itself runs in float.
+    template <typename SampleType>
+    void process(SampleType* const* channels, int numChannels, const float* lfoGains,
+                 const float* lfoDepths, float mix, int numSamples) noexcept;
+
+private:
+    void updateCoefficients() noexcept;
+
+    template <typename SampleType>
+    void processChunk(SampleType* const* channels, int offset, const float* lfoGains,
+                      const float* lfoDepths, float mix, int numSamples) noexcept;
+
+    // Crossover state, one lane per channel
+    alignas(32) float s1[MAX_CHANNELS] = {};
+    alignas(32) float s2[MAX_CHANNELS] = {};
+    alignas(32) float s3[MAX_CHANNELS] = {};
+    alignas(32) float s4[MAX_CHANNELS] = {};
+
+    double sampleRate = 44100.0;
+    float crossoverFrequency = 800.0f;
+    float g = 0.0f;
+    float h = 0.0f;
+    int numChannels = 2;
+    int numLanes = 4;   // numChannels rounded up to a whole SIMD register
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HarmonicTremolo)
+};
@@ -12,8 +12,16 @@
 
 
 HierarchicalPresetMenu::HierarchicalPresetMenu(PresetManager& pm)
-    : presetManager(pm), mainButton("Default")
+    : presetManager(pm), mainButton("Default"), menuModel(pm, PresetIDOffset)
 {
+    // Utility section, after the presets in the root menu
+    menuModel.addUtilityItem(SearchPresetsID, "Search Presets...");
+    menuModel.addUtilityItem(SavePresetID, "Save Current...");
+    menuModel.addUtilityItem(OpenFolderID, "Open Preset Folder");
+    menuModel.addUtilityItem(ImportBankID, "Import Preset Bank...");
+    menuModel.addUtilityItem(ExportBankID, "Export Preset Bank...");
+    menuModel.addUtilityItem(ExtractBankID, "Extract Preset Bank to Files...");
+    
     // Set up the main button as before
     mainButton.setLookAndFeel(&transparentButtonLookAndFeel);
     mainButton.setColour(juce::TextButton::textColourOffId, textColour);
@@ -74,6 +82,22 @@ HierarchicalPresetMenu::HierarchicalPresetMenu(PresetManager& pm)
     addAndMakeVisible(leftArrowButton);
     addAndMakeVisible(rightArrowButton);
     
+    // Typing while the preset bar has focus opens the search box
+    setWantsKeyboardFocus(true);
+    
+    // Saves are written in the background, so a failed write only shows up afterwards
+    presetManager.setPresetWriteFailedCallback([this](const juce::String&, const juce::String& message)
+    {
+        updatePresetDisplay();
+        juce::AlertWindow::showAsync(juce::MessageBoxOptions()
+                                         .withIconType(juce::MessageBoxIconType::WarningIcon)
+                                         .withTitle("Preset Not Saved")
+                                         .withMessage(message)
+                                         .withButton("OK")
+                                         .withAssociatedComponent(this),
+                                     nullptr);
+    });
+    
     // Rest of the initialization as before
     updatePresetDisplay();
     startTimer(100);
@@ -82,6 +106,7 @@ HierarchicalPresetMenu::HierarchicalPresetMenu(PresetManager& pm)
 
 HierarchicalPresetMenu::~HierarchicalPresetMenu()
 {
+    presetManager.setPresetWriteFailedCallback(nullptr);
     mainButton.setLookAndFeel(nullptr);
     mainButton.removeListener(this);
     stopTimer();
@@ -146,67 +171,32 @@ void HierarchicalPresetMenu::buttonClicked(juce::Button* button)
     }
 }
 
-void HierarchicalPresetMenu::navigatePresets(bool goForward)
+bool HierarchicalPresetMenu::keyPressed(const juce::KeyPress& key)
 {
-    // First, define a logical preset order that matches your menu structure
-    juce::StringArray orderedPresets;
-    
-    // Add Factory root presets first (starting with Default and Classic Tremolo)
-    juce::StringArray priorityPresets = {"Default", "Classic Tremolo"};
-    for (const auto& preset : priorityPresets)
-    {
-        if (presetManager.getPresetCategory(preset) == "Factory")
-            orderedPresets.add(preset);
-    }
-    
-    // Add remaining Factory root presets
-    juce::StringArray factoryRootPresets = presetManager.getPresetsInFolder("Factory");
-    for (const auto& preset : factoryRootPresets)
-    {
-        if (!orderedPresets.contains(preset))
-            orderedPresets.add(preset);
-    }
+    auto character = key.getTextCharacter();
+    auto modifiers = key.getModifiers();
     
-    // Add presets from each Factory subcategory in the same order as the menu
-    juce::StringArray categories = presetManager.getFactoryCategories();
-    for (const auto& category : categories)
+    // Space is left alone so it still reaches the host transport
+    if (character > ' ' && !modifiers.isCommandDown() && !modifiers.isCtrlDown() && !modifiers.isAltDown())
     {
-        if (category == "Factory")
-            continue; // Skip the root factory category which we've already handled
-            
-        // Add all presets from this category
-        juce::StringArray categoryPresets = presetManager.getPresetsInFolder(category);
-        for (const auto& preset : categoryPresets)
-            orderedPresets.add(preset);
+        showPresetSearch(juce::String::charToString(character));
+        return true;
     }
     
-    // Finally add user presets
-    juce::StringArray userPresets = presetManager.getPresetsInFolder("User");
-    for (const auto& preset : userPresets)
-        orderedPresets.add(preset);
+    return false;
+}
+
+void HierarchicalPresetMenu::navigatePresets(bool goForward)
+{
+    // The model keeps presets in menu order, so stepping is a direct index lookup
+    menuModel.refresh();
     
-    // Now navigate using this ordered list
-    if (orderedPresets.isEmpty())
+    int newIndex = menuModel.getAdjacentIndex(currentDisplayName, goForward);
+    if (newIndex < 0)
         return;
     
-    // Find the current preset's index in our ordered list
-    int currentIndex = orderedPresets.indexOf(currentDisplayName);
-    if (currentIndex < 0)
-        currentIndex = 0;
-    
-    // Calculate the new index
-    int newIndex;
-    if (goForward)
-    {
-        newIndex = (currentIndex + 1) % orderedPresets.size();
-    }
-    else
-    {
-        newIndex = (currentIndex - 1 + orderedPresets.size()) % orderedPresets.size();
-    }
-    
     // Load the new preset
-    presetManager.loadPreset(orderedPresets[newIndex]);
+    presetManager.loadPreset(menuModel.getPresetName(newIndex));
     updatePresetDisplay();
 }
 
@@ -235,71 +225,9 @@ void HierarchicalPresetMenu::showRootMenu()
         lastScanTime = currentTime;
     }
     
-    // Now create and populate the menu with the freshly scanned presets
-    juce::PopupMenu menu;
-    menuIDToPresetMap.clear();
-    nextMenuID = PresetIDOffset;
-    
-    // Factory Presets section with submenus
-    menu.addSectionHeader("Factory Presets");
-    
-    // Special handling for default presets
-    juce::StringArray rootFactoryPresets = presetManager.getPresetsInFolder("Factory");
-    
-    // First add Default and Classic Tremolo presets if they exist
-    const juce::StringArray priorityPresets = {"Default", "Classic Tremolo"};
-    for (const auto& priorityPreset : priorityPresets)
-    {
-        for (int i = 0; i < rootFactoryPresets.size(); ++i)
-        {
-            if (rootFactoryPresets[i] == priorityPreset)
-            {
-                menuIDToPresetMap[nextMenuID] = priorityPreset;
-                menu.addItem(nextMenuID++, priorityPreset, true, priorityPreset == currentDisplayName);
-                rootFactoryPresets.remove(i);
-                break;
-            }
-        }
-    }
-    
-    // Then add remaining factory presets
-    for (const auto& preset : rootFactoryPresets)
-    {
-        menuIDToPresetMap[nextMenuID] = preset;
-        menu.addItem(nextMenuID++, preset, true, preset == currentDisplayName);
-    }
-    
-    // Add factory subcategories as submenus
-    juce::StringArray categories = presetManager.getFactoryCategories();
-    for (const auto& category : categories)
-    {
-        if (category == "Factory")
-            continue; // Skip the root factory category which we've already handled
-            
-        // Create a submenu for this category
-        juce::PopupMenu subMenu = buildFolderMenu(category);
-        
-        // Extract the subfolder name from the category path
-        juce::String folderName = category.fromLastOccurrenceOf("/", false, false);
-        if (folderName.isEmpty())
-            folderName = category;
-            
-        menu.addSubMenu(folderName, subMenu);
-    }
-    
-    // User Presets section
-    menu.addSectionHeader("User Presets");
-    juce::StringArray userPresets = presetManager.getPresetsInFolder("User");
-    for (const auto& preset : userPresets)
-    {
-        menuIDToPresetMap[nextMenuID] = preset;
-        menu.addItem(nextMenuID++, preset, true, preset == currentDisplayName);
-    }
-    
-    // Utility section
-    menu.addSectionHeader("Utility");
-    menu.addItem(SavePresetID, "Save Current...");
-    menu.addItem(OpenFolderID, "Open Preset Folder");
+    // The cached menu, Utility section included, is only rebuilt when the
+    // catalog or the current preset changes, and is shown without a copy
+    auto& menu = menuModel.getPresetMenu(currentDisplayName);
     
     // Show the menu with correct width constraints
     const int menuWidth = 250; // Set this to match your original design
@@ -311,21 +239,6 @@ void HierarchicalPresetMenu::showRootMenu()
         [this](int result) { menuItemSelected(result); });
 }
 
-juce::PopupMenu HierarchicalPresetMenu::buildFolderMenu(const juce::String& folderPath)
-{
-    juce::PopupMenu menu;
-    
-    // Add all presets in this folder
-    juce::StringArray folderPresets = presetManager.getPresetsInFolder(folderPath);
-    for (const auto& preset : folderPresets)
-    {
-        menuIDToPresetMap[nextMenuID] = preset;
-        menu.addItem(nextMenuID++, preset, true, preset == currentDisplayName);
-    }
-    
-    return menu;
-}
-
 void HierarchicalPresetMenu::menuItemSelected(int menuItemID)
 {
     if (menuItemID == SavePresetID)
@@ -336,11 +249,31 @@ void HierarchicalPresetMenu::menuItemSelected(int menuItemID)
     {
         openPresetFolder();
     }
-    else if (menuIDToPresetMap.find(menuItemID) != menuIDToPresetMap.end())
+    else if (menuItemID == SearchPresetsID)
+    {
+        showPresetSearch();
+    }
+    else if (menuItemID == ImportBankID)
+    {
+        importPresetBank();
+    }
+    else if (menuItemID == ExportBankID)
+    {
+        exportPresetBank();
+    }
+    else if (menuItemID == ExtractBankID)
+    {
+        extractPresetBank();
+    }
+    else if (menuItemID >= PresetIDOffset)
     {
         // Directly load the preset by name rather than by index
-        presetManager.loadPreset(menuIDToPresetMap[menuItemID]);
-        updatePresetDisplay();
+        juce::String presetName = menuModel.getPresetForMenuID(menuItemID);
+        if (presetName.isNotEmpty())
+        {
+            presetManager.loadPreset(presetName);
+            updatePresetDisplay();
+        }
     }
 }
 
@@ -382,3 +315,81 @@ void HierarchicalPresetMenu::openPresetFolder()
     if (presetDir.exists())
         presetDir.revealToUser();
 }
+
+void HierarchicalPresetMenu::importPresetBank()
+{
+    auto fileChooser = std::make_shared<juce::FileChooser>(
+        "Import Preset Bank",
+        juce::File::getSpecialLocation(juce::File::userDocumentsDirectory),
+        PresetBank::fileWildcard
+    );
+
+    fileChooser->launchAsync(juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles,
+                             [this, fileChooser](const juce::FileChooser& fc)
+    {
+        juce::File file = fc.getResult();
+        if (file.existsAsFile())
+        {
+            presetManager.importPresetBank(file);
+            updatePresetDisplay();
+        }
+    });
+}
+
+void HierarchicalPresetMenu::exportPresetBank()
+{
+    auto fileChooser = std::make_shared<juce::FileChooser>(
+        "Export Preset Bank",
+        juce::File::getSpecialLocation(juce::File::userDocumentsDirectory)
+            .getChildFile(juce::String("TremoloViola") + PresetBank::fileExtension),
+        PresetBank::fileWildcard
+    );
+
+    fileChooser->launchAsync(juce::FileBrowserComponent::saveMode, [this, fileChooser](const juce::FileChooser& fc)
+    {
+        juce::File file = fc.getResult();
+        if (file != juce::File{})
+            presetManager.exportPresetBank(file);
+    });
+}
+
+void HierarchicalPresetMenu::extractPresetBank()
+{
+    auto fileChooser = std::make_shared<juce::FileChooser>(
+        "Extract Preset Bank",
+        juce::File::getSpecialLocation(juce::File::userDocumentsDirectory),
+        PresetBank::fileWildcard
+    );
+
+    fileChooser->launchAsync(juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles,
+                             [this, fileChooser](const juce::FileChooser& fc)
+    {
+        juce::File file = fc.getResult();
+        if (file.existsAsFile())
+        {
+            presetManager.extractPresetBank(file);
+            updatePresetDisplay();
+        }
+    });
+}
+
+void HierarchicalPresetMenu::showPresetSearch(const juce::String& initialQuery)
+{
+    auto searchComponent = std::make_unique<PresetSearchComponent>(presetManager, initialQuery);
+    
+    juce::Component::SafePointer<HierarchicalPresetMenu> safeThis(this);
+    searchComponent->onPresetChosen = [safeThis](const juce::String& presetName)
+    {
+        if (safeThis == nullptr)
+            return;
+        
+        safeThis->presetManager.loadPreset(presetName);
+        safeThis->updatePresetDisplay();
+    };
+    
+    // Attach to the editor rather than the desktop so it works inside plugin windows
+    auto* parent = getTopLevelComponent();
+    juce::CallOutBox::launchAsynchronously(std::move(searchComponent),
+                                           parent->getLocalArea(this, getLocalBounds()),
+                                           parent);
+}
@@ -10,6 +10,8 @@
 #pragma once
 #include <JuceHeader.h>
 #include "PresetManager.h"
+#include "PresetMenuModel.h"
+#include "PresetSearchComponent.h"
 #include "CustomComboBox.h"
 #include "CustomToggle.h"
 #include "ArrowNavigationComboBox.h"
@@ -21,6 +23,10 @@
 enum MenuIDs {
     SavePresetID = 100000,
     OpenFolderID = 100001,
+    ImportBankID = 100002,
+    ExportBankID = 100003,
+    SearchPresetsID = 100004,
+    ExtractBankID = 100005,
     PresetIDOffset = 200000  // Preset IDs start from this number
 };
 
@@ -40,6 +46,7 @@ public:
     void resized() override;
     void timerCallback() override;
     void buttonClicked(juce::Button* button) override;
+    bool keyPressed(const juce::KeyPress& key) override;
     
     void updatePresetDisplay();
     
@@ -71,7 +78,10 @@ private:
     void showRootMenu();
     void savePreset();
     void openPresetFolder();
-    juce::PopupMenu buildFolderMenu(const juce::String& folderPath);
+    void importPresetBank();
+    void exportPresetBank();
+    void extractPresetBank();
+    void showPresetSearch(const juce::String& initialQuery = {});
     juce::Image createBackgroundImage(int width, int height);
     
     // Menu result callback
@@ -79,8 +89,8 @@ private:
     
     CustomMenuLookAndFeel menuLookAndFeel;
     
-    std::map<int, juce::String> menuIDToPresetMap;
-    int nextMenuID = PresetIDOffset;
+    // Cached menu structure and preset order, rebuilt when the catalog changes
+    PresetMenuModel menuModel;
     TransparentButtonLookAndFeel transparentButtonLookAndFeel;
     
     juce::Time lastScanTime;
@@ -0,0 +1,44 @@
+/*
+  ==============================================================================
+
+    LFOBank.cpp
+    Created: 18 Oct 2026 8:03:26pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "LFOBank.h"
+
+namespace {
+    constexpr int TABLE_SIZE = LFOBank::TABLE_SIZE;
+    constexpr int TABLE_STRIDE = TABLE_SIZE + 1; // Guard point so interpolation never wraps
+
+    // One table per waveform, built once at full precision and shared by every bank
+    struct WaveformTables {
+        WaveformTables() {
+            data.resize(static_cast<size_t>(TremoloLFO::NumWaveforms) * TABLE_STRIDE);
+
+            for (int shape = 0; shape < TremoloLFO::NumWaveforms; ++shape) {
+                float* table = data.data() + shape * TABLE_STRIDE;
+
+                for (int i = 0; i < TABLE_STRIDE; ++i) {
+                    table[i] = TremoloLFO::getWaveformValue(static_cast<TremoloLFO::Waveform>(shape),
+                                                            static_cast<float>(i) / TABLE_SIZE);
+                }
+            }
+        }
+
+        std::vector<float> data;
+    };
+
+    const float* getWaveformTables() {
+        static const WaveformTables tables;
+        return tables.data.data();
+    }
+}
+
+const float* LFOBank::getWaveformTable(Waveform waveform) noexcept {
+    auto shape = juce::jlimit(0, static_cast<int>(TremoloLFO::NumWaveforms) - 1, static_cast<int>(waveform));
+    return getWaveformTables() + shape * TABLE_STRIDE;
+}
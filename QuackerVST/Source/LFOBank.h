@@ -0,0 +1,34 @@
+/*
+  ==============================================================================
+
+    LFOBank.h
+    Created: 18 Oct 2026 8:03:26pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "TremoloLFO.h"
+
+/**
+ * Shared one-cycle tables of every TremoloLFO waveform.
+ *
+ * Each table is built once, at full precision, the first time any is
+ * asked for, and is then read by every table-driven path: channel spread,
+ * auto-pan, the LFO's morph and the audio-rate mipmaps. Reading a table
+ * costs the same for every waveform, however expensive its formula.
+ */
+class LFOBank {
+public:
+    using Waveform = TremoloLFO::Waveform;
+
+    static constexpr int TABLE_SIZE = 2048;
+
+    // Shared table of TABLE_SIZE + 1 points covering one cycle of the waveform
+    static const float* getWaveformTable(Waveform waveform) noexcept;
+
+private:
+    LFOBank() = delete;
+};
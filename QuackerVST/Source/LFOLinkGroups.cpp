@@ -0,0 +1,118 @@
+/*
+  ==============================================================================
+
+    LFOLinkGroups.cpp
+    Created: 19 Oct 2026 2:34:26am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "LFOLinkGroups.h"
+
+LFOLinkGroups::LFOLinkGroups() {
+    // Allocated up front, so neither publishing nor reading ever allocates
+    for (auto& group : groups) {
+        group.values.allocate(MAX_BLOCK_SIZE, true);
+        group.phases.allocate(MAX_BLOCK_SIZE, true);
+        group.depths.allocate(MAX_BLOCK_SIZE, true);
+    }
+}
+
+LFOLinkGroups::Group* LFOLinkGroups::getGroup(int group) noexcept {
+    return juce::isPositiveAndBelow(group, NUM_GROUPS) ? &groups[group] : nullptr;
+}
+
+const LFOLinkGroups::Group* LFOLinkGroups::getGroup(int group) const noexcept {
+    return juce::isPositiveAndBelow(group, NUM_GROUPS) ? &groups[group] : nullptr;
+}
+
+bool LFOLinkGroups::lead(int group, const void* member, juce::int64 nowTicks, juce::int64 staleAfterTicks) noexcept {
+    auto* g = getGroup(group);
+
+    if (g == nullptr) {
+        return false;
+    }
+
+    const void* current = g->leader.load(std::memory_order_acquire);
+
+    if (current == member) {
+        return true;
+    }
+
+    if (current != nullptr && nowTicks - g->lastPublishTicks.load(std::memory_order_relaxed) <= staleAfterTicks) {
+        return false;
+    }
+
+    // No leader, or one that stopped publishing. Members racing for it all expect the same
+    // old leader, so only one of them wins.
+    if (!g->leader.compare_exchange_strong(current, member, std::memory_order_acq_rel)) {
+        return false;
+    }
+
+    g->lastPublishTicks.store(nowTicks, std::memory_order_relaxed);
+    return true;
+}
+
+void LFOLinkGroups::leave(int group, const void* member) noexcept {
+    if (auto* g = getGroup(group)) {
+        const void* expected = member;
+        g->leader.compare_exchange_strong(expected, nullptr);
+    }
+}
+
+void LFOLinkGroups::publish(int group, juce::int64 hostPosition, const float* values, const float* phases,
+                            const float* depths, int numSamples, double endCyclePosition, juce::int64 nowTicks) noexcept {
+    auto* g = getGroup(group);
+
+    if (g == nullptr || !juce::isPositiveAndNotGreaterThan(numSamples, MAX_BLOCK_SIZE)) {
+        return;
+    }
+
+    const auto sequence = g->sequence.load(std::memory_order_relaxed);
+    g->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::copy(values, values + numSamples, g->values.get());
+    std::copy(phases, phases + numSamples, g->phases.get());
+    std::copy(depths, depths + numSamples, g->depths.get());
+    g->hostPosition.store(hostPosition, std::memory_order_relaxed);
+    g->numSamples.store(numSamples, std::memory_order_relaxed);
+    g->endCyclePosition.store(endCyclePosition, std::memory_order_relaxed);
+
+    g->sequence.store(sequence + 2, std::memory_order_release);
+    g->lastPublishTicks.store(nowTicks, std::memory_order_relaxed);
+}
+
+bool LFOLinkGroups::read(int group, juce::int64 hostPosition, float* values, float* phases, float* depths,
+                         int numSamples, double& endCyclePosition) const noexcept {
+    const auto* g = getGroup(group);
+
+    if (g == nullptr) {
+        return false;
+    }
+
+    const auto sequence = g->sequence.load(std::memory_order_acquire);
+
+    // Mid-write, or a different block; the caller renders its own LFO instead
+    if ((sequence & 1) != 0
+        || g->hostPosition.load(std::memory_order_relaxed) != hostPosition
+        || g->numSamples.load(std::memory_order_relaxed) != numSamples) {
+        return false;
+    }
+
+    std::copy(g->values.get(), g->values.get() + numSamples, values);
+    std::copy(g->phases.get(), g->phases.get() + numSamples, phases);
+    std::copy(g->depths.get(), g->depths.get() + numSamples, depths);
+    const double cyclePosition = g->endCyclePosition.load(std::memory_order_relaxed);
+
+    // A write that started while copying may have torn the block
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (g->sequence.load(std::memory_order_relaxed) != sequence) {
+        return false;
+    }
+
+    endCyclePosition = cyclePosition;
+    return true;
+}
@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    LFOLinkGroups.h
+    Created: 19 Oct 2026 2:34:26am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+/**
+ * Lets plugin instances in the same process run one LFO between them. One
+ * object is shared by every instance through juce::SharedResourcePointer.
+ *
+ * The first instance to render a block for a group becomes its leader and
+ * stays leader until it leaves or stops publishing. A leader that is
+ * bypassed, in a mode without an LFO, or no longer called at all goes
+ * stale, and the next member whose block finds it stale takes the lead
+ * over. The leader publishes the LFO values, phases
+ * and depths of each block, keyed by the host's sample position. Other
+ * members with the same position copy that block instead of running their
+ * own LFO, and they take over the leader's cycle position too. A member
+ * that gets to a block before the leader has published it renders its own
+ * LFO for that block. Because it already shares the leader's phase, the
+ * group stays in step.
+ *
+ * Each group is a seqlock: the leader writes without waiting, and a reader
+ * that overlaps a write simply sees the block as not yet published.
+ */
+class LFOLinkGroups {
+public:
+    static constexpr int NUM_GROUPS = 8;
+    static constexpr int MAX_BLOCK_SIZE = 8192;
+
+    LFOLinkGroups();
+    ~LFOLinkGroups() = default;
+
+    // Audio thread: true if the member leads the group. The member claims the lead when the group
+    // has no leader, or when the leader's last publish is more than staleAfterTicks before nowTicks.
+    bool lead(int group, const void* member, juce::int64 nowTicks, juce::int64 staleAfterTicks) noexcept;
+
+    // Gives up the lead so another member can take over; call when leaving a group
+    void leave(int group, const void* member) noexcept;
+
+    // Leader: publishes the block rendered at the host position, and the cycle position it ended on.
+    // nowTicks is the high-resolution time the staleness check in lead() compares against.
+    void publish(int group, juce::int64 hostPosition, const float* values, const float* phases,
+                 const float* depths, int numSamples, double endCyclePosition, juce::int64 nowTicks) noexcept;
+
+    // Member: copies the leader's block for the same host position; false if it isn't published yet
+    bool read(int group, juce::int64 hostPosition, float* values, float* phases, float* depths,
+              int numSamples, double& endCyclePosition) const noexcept;
+
+private:
+    struct Group {
+        std::atomic<const void*> leader{ nullptr };
+        std::atomic<juce::int64> lastPublishTicks{ 0 };   // When the leader last published or claimed the lead
+        std::atomic<juce::uint32> sequence{ 0 };    // Odd while the leader is writing
+        std::atomic<juce::int64> hostPosition{ -1 };
+        std::atomic<int> numSamples{ 0 };
+        std::atomic<double> endCyclePosition{ 0.0 };
+        juce::HeapBlock<float> values;
+        juce::HeapBlock<float> phases;
+        juce::HeapBlock<float> depths;
+    };
+
+    Group* getGroup(int group) noexcept;
+    const Group* getGroup(int group) const noexcept;
+
+    Group groups[NUM_GROUPS];
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LFOLinkGroups)
+};
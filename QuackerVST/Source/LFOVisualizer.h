@@ -11,6 +11,7 @@
 #pragma once
 #include <JuceHeader.h>
 #include "PerlinNoise.h"
+#include "TremoloLFO.h"
 
 class LFOVisualizer : public juce::Component, public juce::Timer
 {
@@ -132,6 +133,14 @@ public:
             // Get our base waveform value
             float waveformValue = calculateWaveformValue(phase, currentWaveform);
             
+            // While morphing, blend the two waveforms either side of the shape position
+            if (morphEnabled) {
+                int lower = juce::jmin(static_cast<int>(morphPosition), static_cast<int>(TremoloLFO::NumWaveforms) - 2);
+                float blend = juce::jlimit(0.0f, 1.0f, morphPosition - static_cast<float>(lower));
+                float lowerValue = calculateWaveformValue(phase, lower);
+                waveformValue = lowerValue + blend * (calculateWaveformValue(phase, lower + 1) - lowerValue);
+            }
+            
             // If waveshaping is enabled, apply it
             if (waveshapeEnabled) {
                 float shapePhase = std::fmod(phase * waveshapeRate + currentPhase, 1.0f);
@@ -265,6 +274,12 @@ public:
         currentWaveform = waveformType;
     }
 
+    void setMorph(bool enabled, float position)
+    {
+        morphEnabled = enabled;
+        morphPosition = position;
+    }
+
     void setDepth(float newDepth)
     {
         depth = newDepth;
@@ -518,6 +533,8 @@ private:
     }
     
     int currentWaveform = 0;
+    bool morphEnabled = false;
+    float morphPosition = 0.0f;
     float depth = 1.0f;
     float phaseOffset = 0.0f;
     float rate = 1.0f;
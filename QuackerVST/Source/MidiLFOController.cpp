@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+
+    MidiLFOController.cpp
+    Created: 18 Oct 2026 11:34:40pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "MidiLFOController.h"
+
+namespace {
+    constexpr double CLOCK_TIMEOUT_SECONDS = 0.5;   // About 5 BPM at 24 ppq
+    constexpr double TICK_SMOOTHING = 0.1;          // Clock jitter is averaged over roughly ten ticks
+}
+
+void MidiLFOController::prepare(double newSampleRate) noexcept {
+    sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+    reset();
+}
+
+void MidiLFOController::reset() noexcept {
+    numEvents = 0;
+    heldNotes = 0;
+    gateOpenAtStart = false;
+    sampleCounter = 0;
+    lastTickTime = -1;
+    smoothedTickInterval = 0.0;
+}
+
+void MidiLFOController::addEvent(int sample, EventType type) noexcept {
+    if (numEvents < MAX_EVENTS) {
+        events[numEvents++] = { sample, type };
+    }
+}
+
+void MidiLFOController::process(const juce::MidiBuffer& midiMessages, int numSamples) noexcept {
+    numEvents = 0;
+    gateOpenAtStart = heldNotes > 0;
+
+    // MidiBuffer is sorted by position, so the events come out in order
+    for (const auto metadata : midiMessages) {
+        const auto message = metadata.getMessage();
+        const int position = juce::jlimit(0, numSamples - 1, metadata.samplePosition);
+
+        if (message.isNoteOn()) {
+            if (retriggerOnNotes) {
+                addEvent(position, EventType::Retrigger);
+            }
+
+            if (heldNotes++ == 0 && gateEnabled) {
+                addEvent(position, EventType::GateOpen);
+            }
+        } else if (message.isNoteOff()) {
+            if (heldNotes > 0 && --heldNotes == 0 && gateEnabled) {
+                addEvent(position, EventType::GateClose);
+            }
+        } else if (message.isAllNotesOff() || message.isAllSoundOff()) {
+            if (heldNotes > 0 && gateEnabled) {
+                addEvent(position, EventType::GateClose);
+            }
+
+            heldNotes = 0;
+        } else if (message.isMidiClock()) {
+            handleClockTick(sampleCounter + position);
+        } else if (message.isMidiStart()) {
+            // A sequencer start lines the cycle up with its downbeat
+            addEvent(position, EventType::Retrigger);
+            lastTickTime = -1;
+        }
+    }
+
+    sampleCounter += numSamples;
+}
+
+void MidiLFOController::handleClockTick(juce::int64 tickTime) noexcept {
+    if (lastTickTime >= 0) {
+        const auto interval = static_cast<double>(tickTime - lastTickTime);
+
+        if (interval > 0.0) {
+            smoothedTickInterval = smoothedTickInterval > 0.0
+                                       ? smoothedTickInterval + TICK_SMOOTHING * (interval - smoothedTickInterval)
+                                       : interval;
+        }
+    }
+
+    lastTickTime = tickTime;
+}
+
+double MidiLFOController::getClockBPM() const noexcept {
+    if (lastTickTime < 0 || smoothedTickInterval <= 0.0
+        || static_cast<double>(sampleCounter - lastTickTime) > CLOCK_TIMEOUT_SECONDS * sampleRate) {
+        return 0.0;
+    }
+
+    return 60.0 * sampleRate / (smoothedTickInterval * CLOCKS_PER_QUARTER);
+}
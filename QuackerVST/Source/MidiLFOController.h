@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    MidiLFOController.h
+    Created: 18 Oct 2026 11:34:40pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+/**
+ * Turns the incoming MIDI of a block into LFO events.
+ *
+ * The buffer is scanned once per block. Note-ons become retrigger points,
+ * the first held note opens the depth gate and the last release closes
+ * it, and MIDI clock ticks are timed to estimate a tempo for hosts that
+ * don't provide a playhead. The processor renders the LFO in segments
+ * between the events, so nothing is checked per sample.
+ */
+class MidiLFOController {
+public:
+    enum class EventType {
+        Retrigger = 0,
+        GateOpen,
+        GateClose
+    };
+
+    struct Event {
+        int sample = 0;
+        EventType type = EventType::Retrigger;
+    };
+
+    MidiLFOController() = default;
+    ~MidiLFOController() = default;
+
+    void prepare(double newSampleRate) noexcept;
+    void reset() noexcept;
+
+    void setRetriggerOnNotes(bool shouldRetrigger) noexcept { retriggerOnNotes = shouldRetrigger; }
+    void setGateEnabled(bool shouldGate) noexcept { gateEnabled = shouldGate; }
+
+    // Collects this block's events; MIDI clock is timed whether or not it ends up being used
+    void process(const juce::MidiBuffer& midiMessages, int numSamples) noexcept;
+
+    int getNumEvents() const noexcept { return numEvents; }
+    const Event& getEvent(int index) const noexcept { return events[index]; }
+
+    // Gate state at the start of the block, before any of this block's events
+    bool isGateOpenAtStart() const noexcept { return !gateEnabled || gateOpenAtStart; }
+
+    // Tempo from MIDI clock, or zero if no clock has arrived recently
+    double getClockBPM() const noexcept;
+
+    static constexpr int MAX_EVENTS = 64;
+
+private:
+    void addEvent(int sample, EventType type) noexcept;
+    void handleClockTick(juce::int64 tickTime) noexcept;
+
+    Event events[MAX_EVENTS];
+    int numEvents = 0;
+
+    double sampleRate = 44100.0;
+    bool retriggerOnNotes = false;
+    bool gateEnabled = false;
+    bool gateOpenAtStart = false;
+    int heldNotes = 0;
+
+    // Clock timing, in samples since prepare()
+    juce::int64 sampleCounter = 0;
+    juce::int64 lastTickTime = -1;
+    double smoothedTickInterval = 0.0;
+
+    static constexpr int CLOCKS_PER_QUARTER = 24;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MidiLFOController)
+};
@@ -10,12 +10,10 @@
 #include "PluginEditor.h"
 #include "LFOVisualizer.h"
 
-juce::Image QuackerVSTAudioProcessorEditor::backgroundImage;
-bool QuackerVSTAudioProcessorEditor::backgroundGenerated = false;
 
 //==============================================================================
 QuackerVSTAudioProcessorEditor::QuackerVSTAudioProcessorEditor (QuackerVSTAudioProcessor& p)
-    : AudioProcessorEditor (&p), audioProcessor (p), presetMenu(p.getPresetManager())
+    : AudioProcessorEditor (&p), audioProcessor (p), waveformEditor(p), presetMenu(p.getPresetManager())
 {
     
         
@@ -35,16 +33,6 @@ QuackerVSTAudioProcessorEditor::QuackerVSTAudioProcessorEditor (QuackerVSTAudioP
     // Make sure that before the constructor has finished, you've set the
     // editor's size to whatever you need it to be.
     setSize (800, 700);
-
-    // Increment the instance counter
-    ++instanceCount;
-    
-    // Generate background only if it hasn't been generated yet
-    if (!backgroundGenerated)
-    {
-        generateBackgroundPattern(800, 700);
-        backgroundGenerated = true;
-    }
     
     startTimerHz(100); //Starting a timer which updates the GUI
     
@@ -97,6 +85,7 @@ QuackerVSTAudioProcessorEditor::QuackerVSTAudioProcessorEditor (QuackerVSTAudioP
     waveformSelector.getComboBox().addItem("Guitar Pick", 17);
     waveformSelector.getComboBox().addItem("Vintage Chorus", 18);
     waveformSelector.getComboBox().addItem("Slow Gear", 19);
+    waveformSelector.getComboBox().addItem("Custom", 20);
     addAndMakeVisible(waveformSelector);
 
 
@@ -250,6 +239,7 @@ QuackerVSTAudioProcessorEditor::QuackerVSTAudioProcessorEditor (QuackerVSTAudioP
         audioProcessor.apvts, "lfoNoteDivision", divisionSelector.getComboBox());
     //
     addAndMakeVisible(lfoVisualizer);
+    addChildComponent(waveformEditor);
     
     //LookandFeel
     lfoRateSlider.setLookAndFeel(&customDialLookAndFeel);
@@ -293,14 +283,6 @@ QuackerVSTAudioProcessorEditor::~QuackerVSTAudioProcessorEditor()
     waveshapeRateSlider.setLookAndFeel(nullptr);
     waveshapeDepthSlider.setLookAndFeel(nullptr);
     waveshapeWaveformSelector.getComboBox().setLookAndFeel(nullptr);
-    
-    // Decrement instance counter and clean up resources if this is the last instance
-    if (--instanceCount == 0)
-    {
-        // Only clean up the static resources when the last instance is closed
-        cleanupStaticResources();
-    }
-    
 }
 
 void QuackerVSTAudioProcessorEditor::timerCallback()
@@ -324,6 +306,8 @@ void QuackerVSTAudioProcessorEditor::timerCallback()
 
         // Update visualizer with current parameter values
         lfoVisualizer.setWaveform(static_cast<int>(waveformParam->load()));
+        lfoVisualizer.setMorph(audioProcessor.apvts.getRawParameterValue("lfoMorph")->load() > 0.5f,
+                               audioProcessor.apvts.getRawParameterValue("lfoShape")->load());
         lfoVisualizer.setDepth(depthParam->load());
         lfoVisualizer.setPhaseOffset(phaseOffsetParam->load());
         
@@ -345,6 +329,13 @@ void QuackerVSTAudioProcessorEditor::timerCallback()
         lfoVisualizer.setActive(false, false);
     }
     
+    // The Custom waveform swaps the visualizer for its breakpoint editor
+    const bool showWaveformEditor = static_cast<int>(audioProcessor.apvts.getRawParameterValue("lfoWaveform")->load())
+                                    == static_cast<int>(TremoloLFO::Waveform::Custom);
+    waveformEditor.setVisible(showWaveformEditor);
+    lfoVisualizer.setVisible(!showWaveformEditor);
+    waveformEditor.refreshFromProcessor();
+    
     // Update waveshaping parameters
     auto waveshapeRateParam = audioProcessor.apvts.getRawParameterValue("waveshapeRate");
     auto waveshapeDepthParam = audioProcessor.apvts.getRawParameterValue("waveshapeDepth");
@@ -362,10 +353,12 @@ void QuackerVSTAudioProcessorEditor::timerCallback()
 }
     
 //==============================================================================
-void QuackerVSTAudioProcessorEditor::generateBackgroundPattern(int width, int height)
+juce::Image QuackerVSTAudioProcessorEditor::generateBackgroundPattern(int width, int height, float scale)
 {
-    backgroundImage = juce::Image(juce::Image::ARGB, width, height, true);
-    juce::Graphics g(backgroundImage);
+    // Drawn in logical coordinates at the display's pixel density
+    juce::Image image(juce::Image::ARGB, juce::roundToInt(width * scale), juce::roundToInt(height * scale), true);
+    juce::Graphics g(image);
+    g.addTransform(juce::AffineTransform::scale(scale));
     
     auto bounds = juce::Rectangle<float>(0, 0, width, height);
     
@@ -560,12 +553,23 @@ void QuackerVSTAudioProcessorEditor::generateBackgroundPattern(int width, int he
     
     g.setGradientFill(finalSheen);
     g.fillAll();
+    
+    return image;
 }
 
 void QuackerVSTAudioProcessorEditor::paint(juce::Graphics& g)
 {
-    // Draw cached background
-    g.drawImageAt(backgroundImage, 0, 0);
+    // Draw cached background, fetching a sharper copy if the editor moved to a denser display
+    const float scale = SharedResourceCache::quantiseScale(g.getInternalContext().getPhysicalPixelScaleFactor());
+    
+    if (backgroundImage == nullptr || scale != backgroundScale)
+    {
+        backgroundImage = sharedResources->get<juce::Image>({ "editorBackground", 0.0, scale },
+                                                            [scale] { return generateBackgroundPattern(800, 700, scale); });
+        backgroundScale = scale;
+    }
+    
+    g.drawImageTransformed(*backgroundImage, juce::AffineTransform::scale(1.0f / scale));
     
     // Draw controls on top
     drawControls(g);
@@ -685,6 +689,7 @@ void QuackerVSTAudioProcessorEditor::resized()
     // Position visualizer
     auto visualizerBounds = bounds.removeFromTop(visualizerHeight + (visualizerMargin * 2));
     lfoVisualizer.setBounds(visualizerBounds.reduced(visualizerMargin));
+    waveformEditor.setBounds(lfoVisualizer.getBounds());
     
     // Calculate sizes for uniform dials
     const int dialSize = 150;
@@ -760,5 +765,3 @@ void QuackerVSTAudioProcessorEditor::resized()
                                    buttonWidth,
                                    buttonHeight);
 }
-
-int QuackerVSTAudioProcessorEditor::instanceCount = 0;
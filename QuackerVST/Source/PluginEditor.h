@@ -12,6 +12,7 @@
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
 #include "LFOVisualizer.h"
+#include "WaveformEditorComponent.h"
 #include "CustomDialLookAndFeel.h"
 #include "CustomToggle.h"
 #include "PerlinNoise.h"
@@ -19,6 +20,7 @@
 #include "ArrowNavigationComboBox.h"
 #include "HierarchicalPresetMenu.h"
 #include "Fonts/FontManager.h"
+#include "SharedResourceCache.h"
 
 //==============================================================================
 /**
@@ -35,16 +37,6 @@ public:
     void resized() override;
     void timerCallback() override;
     void mouseDown(const juce::MouseEvent& event) override;
-    
-    static void cleanupStaticResources()
-    {
-        // Only clean up if we have no instances left
-        if (instanceCount == 0)
-        {
-            backgroundImage = juce::Image(); // Replace with empty image to release resources
-            backgroundGenerated = false;
-        }
-    };
 
 private:
     // This reference is provided as a quick way for your editor to
@@ -52,6 +44,7 @@ private:
     QuackerVSTAudioProcessor& audioProcessor;
     
     LFOVisualizer lfoVisualizer;
+    WaveformEditorComponent waveformEditor;
     
     juce::Slider lfoRateSlider, lfoDepthSlider; //Defining sliders for LFO control
     juce::ComboBox lfoWaveformBox;
@@ -86,10 +79,12 @@ private:
     
     float backgroundPhase = 0.0f;
     void drawControls(juce::Graphics& g);
-    static juce::Image backgroundImage;  // Make it static
-    static bool backgroundGenerated;     // Track if we've generated it
-    static void generateBackgroundPattern(int width, int height); // Static generator
-    static int instanceCount;
+    
+    // Shared with every other open editor at the same display scale, and built on first paint
+    juce::SharedResourcePointer<SharedResourceCache> sharedResources;
+    std::shared_ptr<const juce::Image> backgroundImage;
+    float backgroundScale = 0.0f;
+    static juce::Image generateBackgroundPattern(int width, int height, float scale);
     
     // Waveshaping controls
      juce::Slider waveshapeRateSlider, waveshapeDepthSlider;
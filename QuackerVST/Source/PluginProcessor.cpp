@@ -46,6 +46,9 @@ apvts(*this, nullptr, "Parameters", createParameters())
 QuackerVSTAudioProcessor::~QuackerVSTAudioProcessor()
 {
     try {
+        // A restore posted from a host thread must not run against a half-destroyed processor
+        cancelPendingUpdate();
+        
         // Safely remove parameter listeners
         for (auto* param : getParameters()) {
             if (param != nullptr) {
@@ -53,8 +56,8 @@ QuackerVSTAudioProcessor::~QuackerVSTAudioProcessor()
             }
         }
         
-        // Clean up static resources
-        QuackerVSTAudioProcessorEditor::cleanupStaticResources();
+        // Hand the group's lead to another instance
+        linkGroups->leave(linkGroup, this);
     }
     catch (...) {
         // Destructors shouldn't throw
@@ -169,6 +172,46 @@ void QuackerVSTAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
         reportError(ProcessorError::InvalidBPM, "Failed to set LFO BPM");
     }
     
+    channelSpread.setNumChannels(getTotalNumInputChannels());
+    harmonicTremolo.prepare(sampleRate, getTotalNumInputChannels());
+    envelopeFollower.prepare(sampleRate);
+    midiController.prepare(sampleRate);
+    stepSequencer.prepare(sampleRate);
+    
+    // Start the mix where it is, rather than ramping in from silence
+    parameterSmoothers.setRampTime(MixLane, 0.05);
+    parameterSmoothers.setRampTime(MorphLane, 0.05);   // Same ramp as the LFO's own morph
+    
+    if (auto* mixParam = apvts.getRawParameterValue("mix")) {
+        parameterSmoothers.setCurrentAndTargetValue(MixLane, mixParam->load());
+    }
+    
+    parameterSmoothers.prepare(sampleRate);
+    
+    qualityGovernor.prepare(sampleRate);
+    applyQualityTier(qualityGovernor.getTier());
+    
+    try {
+        audioRateModulator.prepare(sampleRate, samplesPerBlock, getTotalNumInputChannels());
+        
+        // Only 64-bit hosts need the float copy for the modulator
+        if (isUsingDoublePrecision()) {
+            audioRateConversionBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+        } else {
+            audioRateConversionBuffer.setSize(0, 0);
+        }
+    }
+    catch (const std::exception& e) {
+        reportError(ProcessorError::BufferAllocationFailed,
+                   "Failed to prepare audio-rate modulator: " + juce::String(e.what()));
+    }
+    
+    if (auto* modeParam = apvts.getRawParameterValue("lfoMode")) {
+        lfoMode = static_cast<LFOMode>(juce::jlimit(0, 5, static_cast<int>(modeParam->load())));
+    }
+    
+    updateReportedLatency();
+    
     // Allocate LFO buffer with error handling
     if (!allocateLFOBuffer(samplesPerBlock)) {
         reportError(ProcessorError::BufferAllocationFailed,
@@ -180,10 +223,14 @@ void QuackerVSTAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
     try {
         auto coefficients = juce::dsp::IIR::Coefficients<float>::makeHighPass(
             sampleRate, 5.0f, 0.707f);
+        auto doubleCoefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(
+            sampleRate, 5.0, 0.707);
         
-        if (coefficients != nullptr) {
+        if (coefficients != nullptr && doubleCoefficients != nullptr) {
             *dcFilter.state = *coefficients;
             dcFilter.prepare(currentSpecs);
+            *doublePrecisionDCFilter.state = *doubleCoefficients;
+            doublePrecisionDCFilter.prepare(currentSpecs);
         } else {
             reportError(ProcessorError::DCFilterInitFailed, "Failed to create DC filter coefficients");
         }
@@ -198,7 +245,12 @@ void QuackerVSTAudioProcessor::releaseResources()
 {
     try {
         dcFilter.reset();
+        doublePrecisionDCFilter.reset();
         lfoValuesBuffer.free();
+        lfoPhaseBuffer.free();
+        lfoDepthBuffer.free();
+        channelGainBuffer.free();
+        std::fill(std::begin(channelGains), std::end(channelGains), nullptr);
         lfoBufferSize = 0;
     }
     catch (...) {
@@ -217,8 +269,8 @@ bool QuackerVSTAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts
     auto mainOut = layouts.getMainOutputChannelSet();
     auto mainIn = layouts.getMainInputChannelSet();
     
-    if (mainOut != juce::AudioChannelSet::mono() &&
-        mainOut != juce::AudioChannelSet::stereo()) {
+    // Anything from mono up to 7.1.4
+    if (mainOut.isDisabled() || mainOut.size() > maxNumChannels) {
         return false;
     }
 
@@ -234,9 +286,22 @@ bool QuackerVSTAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts
 #endif
 
 void QuackerVSTAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processSamples(buffer, midiMessages);
+}
+
+void QuackerVSTAudioProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processSamples(buffer, midiMessages);
+}
+
+template <typename SampleType>
+void QuackerVSTAudioProcessor::processSamples(juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
-    juce::ignoreUnused(midiMessages);
+    
+    // Debug builds report any allocation or lock taken from here on
+    const RealtimeSafetyChecker::ScopedRealtimeSection realtimeSection;
     
     // Validate buffer
     if (buffer.getNumSamples() == 0 || buffer.getNumSamples() > maxBlockSize) {
@@ -248,6 +313,14 @@ void QuackerVSTAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
     const int totalNumOutputChannels = getTotalNumOutputChannels();
     const int numSamples = buffer.getNumSamples();
     
+    // Time this block against its deadline. The tier picked from earlier blocks applies to this one.
+    QualityGovernor::ScopedMeasurement loadMeasurement(qualityGovernor, numSamples);
+    qualityGovernor.setNonRealtime(isNonRealtime());
+    
+    if (qualityGovernor.getTier() != appliedQualityTier) {
+        applyQualityTier(qualityGovernor.getTier());
+    }
+    
     // Clear unused output channels
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, numSamples);
@@ -262,12 +335,21 @@ void QuackerVSTAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
     
     // Get playhead info safely
     bool isPlaying = false;
+    bool hasHostTempo = false;
+    double hostPpqPosition = -1.0;
+    juce::int64 hostSamplePosition = -1;
     juce::AudioPlayHead::CurrentPositionInfo posInfo;
     
     if (auto* playHead = getPlayHead()) {
         try {
             if (playHead->getCurrentPosition(posInfo)) {
                 isPlaying = posInfo.isPlaying;
+                hasHostTempo = posInfo.bpm > 0.0;
+                
+                if (isPlaying) {
+                    hostPpqPosition = posInfo.ppqPosition;
+                    hostSamplePosition = posInfo.timeInSamples;
+                }
                 
                 // Validate and store BPM
                 if (posInfo.bpm > 0.0 && posInfo.bpm <= maxValidBPM) {
@@ -288,19 +370,26 @@ void QuackerVSTAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
         }
     }
 
+    // One scan of the MIDI buffer for retriggers, the depth gate and clock
+    midiController.process(midiMessages, numSamples);
+    
+    // Without a host tempo, an external sequencer's MIDI clock stands in for it
+    if (!hasHostTempo && midiClockSync) {
+        const double clockBPM = midiController.getClockBPM();
+        
+        if (clockBPM >= minValidBPM && clockBPM <= maxValidBPM) {
+            currentBPM = clockBPM;
+            lastKnownGoodBPM = clockBPM;
+        }
+    }
+    
     // Update LFO BPM safely
     lfo.setBPM(getSafeBPM());
 
-    // Check for audio signal
-    bool hasSignal = false;
-    for (int channel = 0; channel < totalNumInputChannels && !hasSignal; ++channel) {
-        auto* channelData = buffer.getReadPointer(channel);
-        for (int sample = 0; sample < numSamples && !hasSignal; ++sample) {
-            if (std::abs(channelData[sample]) > audioDetectionThreshold) {
-                hasSignal = true;
-            }
-        }
-    }
+    // Check for audio signal; the same pass over the input feeds the envelope follower
+    const float inputPeak = envelopeFollower.process(buffer.getArrayOfReadPointers(),
+                                                     totalNumInputChannels, numSamples);
+    bool hasSignal = inputPeak > audioDetectionThreshold;
     
     audioInputDetected = hasSignal;
     
@@ -321,48 +410,138 @@ void QuackerVSTAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
     // Process parameter updates safely
     processParameterUpdates();
     
-    // Get mix parameter
+    // Pick up the newest compiled custom shape; the table stays valid for the whole block.
+    // A morph can blend into Custom while the nearest waveform is still Slow Gear.
+    const bool usesCustomTable = lfo.getWaveform() == TremoloLFO::Custom;
+    
+    if (usesCustomTable || lfo.isMorphEnabled()) {
+        const float* customTable = customWaveform.acquireTable();
+        lfo.setCustomTable(customTable);
+        
+        // Spread and auto-pan read one table, so a morph hands them the blend rather than the nearest waveform
+        const float* sharedTable = lfo.isMorphEnabled() ? updateMorphedTable(customTable) : customTable;
+        channelSpread.setWaveformTable(sharedTable);
+        autoPanner.setWaveformTable(sharedTable);
+    }
+    
+    // Get mix parameter; the gain loop below follows its ramp, the other paths take it once per block
     auto* mixParam = apvts.getRawParameterValue("mix");
-    float mix = mixParam ? mixParam->load() : 1.0f;
+    parameterSmoothers.setTargetValue(MixLane, mixParam ? mixParam->load() : 1.0f);
+    const float mix = parameterSmoothers.getCurrentValue(MixLane);
+    
+    // Per-channel phase spread only applies to the channels the layout actually has
+    if (channelSpread.getNumChannels() != totalNumInputChannels) {
+        channelSpread.setNumChannels(totalNumInputChannels);
+    }
+    
+    const bool lfoRunning = hasSignal || lfo.isWaitingForReset();
+    
+    // AM and ring mod run their own audio-rate oscillator instead of the LFO
+    const bool audioRate = hasSignal && (lfoMode == LFOMode::AudioRateAM || lfoMode == LFOMode::RingMod);
+    
+    const bool harmonic = lfoRunning && lfoMode == LFOMode::Harmonic
+                          && totalNumInputChannels <= HarmonicTremolo::MAX_CHANNELS;
+    
+    // Auto-pan needs a stereo pair; other layouts fall back to tremolo
+    const bool autoPanning = lfoRunning && lfoMode == LFOMode::AutoPan && totalNumInputChannels == 2;
+    const bool stepPattern = lfoRunning && lfoMode == LFOMode::Pattern;
+    const bool spreading = lfoRunning && !autoPanning && !harmonic && !audioRate && !stepPattern && channelSpread.isSpreading()
+                           && totalNumInputChannels <= ChannelPhaseSpread::MAX_CHANNELS;
+    const bool perChannelGains = autoPanning || spreading;
     
     // Generate LFO values
-    if (hasSignal || lfo.isWaitingForReset()) {
-        for (int i = 0; i < numSamples; ++i) {
-            lfoValuesBuffer[i] = lfo.getNextSample();
+    if (audioRate) {
+        if constexpr (std::is_same_v<SampleType, float>) {
+            auto block = juce::dsp::AudioBlock<float>(buffer).getSubsetChannelBlock(0, static_cast<size_t>(totalNumInputChannels));
+            audioRateModulator.process(block, mix);
+        } else if (audioRateConversionBuffer.getNumChannels() >= totalNumInputChannels
+                   && audioRateConversionBuffer.getNumSamples() >= numSamples) {
+            for (int channel = 0; channel < totalNumInputChannels; ++channel) {
+                const SampleType* source = buffer.getReadPointer(channel);
+                float* converted = audioRateConversionBuffer.getWritePointer(channel);
+                
+                for (int i = 0; i < numSamples; ++i) {
+                    converted[i] = static_cast<float>(source[i]);
+                }
+            }
+            
+            auto block = juce::dsp::AudioBlock<float>(audioRateConversionBuffer)
+                             .getSubBlock(0, static_cast<size_t>(numSamples))
+                             .getSubsetChannelBlock(0, static_cast<size_t>(totalNumInputChannels));
+            audioRateModulator.process(block, mix);
+            
+            for (int channel = 0; channel < totalNumInputChannels; ++channel) {
+                const float* converted = audioRateConversionBuffer.getReadPointer(channel);
+                SampleType* destination = buffer.getWritePointer(channel);
+                
+                for (int i = 0; i < numSamples; ++i) {
+                    destination[i] = static_cast<SampleType>(converted[i]);
+                }
+            }
+        }
+    } else if (stepPattern) {
+        // Table read from the precomputed pattern envelope, locked to the host's beat when playing
+        stepSequencer.process(lfoValuesBuffer, numSamples, getSafeBPM(), hostPpqPosition);
+    } else if (perChannelGains || harmonic) {
+        renderLinkedLFO(numSamples, true, hostSamplePosition);
+        
+        if (harmonic) {
+            // Crossover, both band gains and the dry mix in one pass over all channels
+            harmonicTremolo.process(buffer.getArrayOfWritePointers(), totalNumInputChannels,
+                                    lfoValuesBuffer, lfoDepthBuffer, mix, numSamples);
+        } else if (autoPanning) {
+            // Pan gains replace the tremolo gain, and go through the same gain loop below
+            autoPanner.process(lfoPhaseBuffer, lfoDepthBuffer, channelGains[0], channelGains[1], numSamples);
+        } else {
+            // One table lookup per channel from the shared phase, all channels at once
+            channelSpread.process(lfoValuesBuffer, lfoPhaseBuffer, lfoDepthBuffer, channelGains, numSamples);
         }
+    } else if (lfoRunning) {
+        renderLinkedLFO(numSamples, false, hostSamplePosition);
     } else {
         juce::FloatVectorOperations::fill(lfoValuesBuffer, 1.0f, numSamples);
     }
     
     // Process audio channels
-    for (int channel = 0; channel < totalNumInputChannels; ++channel) {
-        auto* channelData = buffer.getWritePointer(channel);
-        
-        if (hasSignal || lfo.isWaitingForReset()) {
-            // Store dry signal if needed
-            if (mix < 1.0f) {
-                juce::AudioBuffer<float> dryBuffer(1, numSamples);
-                dryBuffer.copyFrom(0, 0, channelData, numSamples);
-                
-                // Apply modulation
-                juce::FloatVectorOperations::multiply(channelData, lfoValuesBuffer, numSamples);
+    if ((hasSignal || lfo.isWaitingForReset()) && !harmonic && !audioRate) {
+        // The mix folds into the gain, dry * (1 - mix + mix * gain), so no dry copy is needed
+        for (int start = 0; start < numSamples; start += SmoothedParameterBank::CHUNK_SIZE) {
+            const int count = juce::jmin(SmoothedParameterBank::CHUNK_SIZE, numSamples - start);
+            parameterSmoothers.advance(count);
+            
+            const bool mixSettled = parameterSmoothers.isSettled(MixLane);
+            const float settledMix = parameterSmoothers.getCurrentValue(MixLane);
+            const float* mixRamp = parameterSmoothers.getRamp(MixLane);
+            
+            for (int channel = 0; channel < totalNumInputChannels; ++channel) {
+                auto* channelData = buffer.getWritePointer(channel) + start;
+                const float* gains = (perChannelGains ? channelGains[channel] : lfoValuesBuffer.get()) + start;
                 
-                // Apply mix
-                juce::FloatVectorOperations::multiply(channelData, mix, numSamples);
-                juce::FloatVectorOperations::addWithMultiply(channelData,
-                    dryBuffer.getReadPointer(0), 1.0f - mix, numSamples);
-            } else {
-                // Full wet signal
-                juce::FloatVectorOperations::multiply(channelData, lfoValuesBuffer, numSamples);
+                if (mixSettled) {
+                    for (int i = 0; i < count; ++i) {
+                        channelData[i] *= 1.0f - settledMix + settledMix * gains[i];
+                    }
+                } else {
+                    for (int i = 0; i < count; ++i) {
+                        channelData[i] *= 1.0f - mixRamp[i] + mixRamp[i] * gains[i];
+                    }
+                }
             }
         }
+    } else {
+        parameterSmoothers.skip(numSamples);
     }
 
     // Apply DC filtering safely
     try {
-        juce::dsp::AudioBlock<float> block(buffer);
-        juce::dsp::ProcessContextReplacing<float> context(block);
-        dcFilter.process(context);
+        juce::dsp::AudioBlock<SampleType> block(buffer);
+        juce::dsp::ProcessContextReplacing<SampleType> context(block);
+        
+        if constexpr (std::is_same_v<SampleType, float>) {
+            dcFilter.process(context);
+        } else {
+            doublePrecisionDCFilter.process(context);
+        }
     }
     catch (...) {
         DBG("DC filter processing error");
@@ -390,6 +569,7 @@ juce::AudioProcessorEditor* QuackerVSTAudioProcessor::createEditor()
 void QuackerVSTAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
     try {
+        const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(stateLock);
         auto state = apvts.copyState();
         
         if (presetManager) {
@@ -415,7 +595,9 @@ void QuackerVSTAudioProcessor::setStateInformation(const void* data, int sizeInB
                 
                 juce::String savedPresetName = vt.getProperty("presetName", "Default");
                 
+                const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(stateLock);
                 apvts.replaceState(vt);
+                restoreNonParameterState();
                 
                 if (presetManager) {
                     if (!presetManager->loadPreset(savedPresetName)) {
@@ -439,6 +621,8 @@ juce::AudioProcessorValueTreeState::ParameterLayout QuackerVSTAudioProcessor::cr
     auto tremoloGroup = std::make_unique<juce::AudioProcessorParameterGroup>("tremolo", "Tremolo", "|");
     auto waveshapeGroup = std::make_unique<juce::AudioProcessorParameterGroup>("waveshape", "Waveshaping", "|");
     auto utilityGroup = std::make_unique<juce::AudioProcessorParameterGroup>("utility", "Utility", "|");
+    auto dynamicsGroup = std::make_unique<juce::AudioProcessorParameterGroup>("dynamics", "Dynamics", "|");
+    auto midiGroup = std::make_unique<juce::AudioProcessorParameterGroup>("midi", "MIDI", "|");
     
     // LFO Rate with proper range validation
     auto rateParam = std::make_unique<juce::AudioParameterFloat>(
@@ -479,7 +663,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout QuackerVSTAudioProcessor::cr
             "Soft Square", "Fender Style", "Wurlitzer Style", "Vox Style",
             "Magnatone Style", "Pulse Decay", "Bouncing Ball", "Multi Sine",
             "Optical Style", "Twin Peaks", "Smooth Random", "Guitar Pick",
-            "Vintage Chorus", "Slow Gear"
+            "Vintage Chorus", "Slow Gear", "Custom"
         },
         0
     );
@@ -516,6 +700,120 @@ juce::AudioProcessorValueTreeState::ParameterLayout QuackerVSTAudioProcessor::cr
         }
     );
     lfoGroup->addChild(std::move(phaseOffsetParam));
+
+    // Waveform morph: a continuous shape position replaces the waveform choice while enabled
+    auto morphParam = std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("lfoMorph", 1),
+        "LFO Morph",
+        false
+    );
+    lfoGroup->addChild(std::move(morphParam));
+
+    auto shapeParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("lfoShape", 1),
+        "LFO Shape",
+        juce::NormalisableRange<float>(0.0f, TremoloLFO::MAX_MORPH_POSITION, 0.01f),
+        0.0f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(value, 2); }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(0.0f, TremoloLFO::MAX_MORPH_POSITION, text.getFloatValue());
+        }
+    );
+    lfoGroup->addChild(std::move(shapeParam));
+    
+    // Phase spread across output channels, for rotating tremolo on multichannel layouts
+    auto channelSpreadParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("channelSpread", 1),
+        "Channel Phase Spread",
+        juce::NormalisableRange<float>(0.0f, 360.0f, 1.0f),
+        0.0f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(int(value)) + juce::String(juce::CharPointer_UTF8("°")); }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(0.0f, 360.0f, text.getFloatValue());
+        }
+    );
+    lfoGroup->addChild(std::move(channelSpreadParam));
+    
+    // Tremolo or stereo auto-pan
+    auto modeParam = std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID("lfoMode", 1),
+        "LFO Mode",
+        juce::StringArray{ "Tremolo", "Auto-Pan", "Harmonic", "AM", "Ring Mod", "Pattern" },
+        0
+    );
+    lfoGroup->addChild(std::move(modeParam));
+    
+    // Length of one pattern step, always tempo-locked
+    auto stepDivisionParam = std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID("seqStepDivision", 1),
+        "Pattern Step",
+        juce::StringArray{ "1/4", "1/8", "1/16", "1/32" },
+        2  // default to 1/16 note
+    );
+    lfoGroup->addChild(std::move(stepDivisionParam));
+    
+    // Modulator frequency for the AM and ring mod modes, far above the LFO range
+    auto amFrequencyParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("amFrequency", 1),
+        "AM Frequency",
+        juce::NormalisableRange<float>(AudioRateModulator::MIN_FREQUENCY, AudioRateModulator::MAX_FREQUENCY, 0.1f, 0.3f),
+        440.0f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(value, 1) + " Hz"; }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(AudioRateModulator::MIN_FREQUENCY, AudioRateModulator::MAX_FREQUENCY, text.getFloatValue());
+        }
+    );
+    lfoGroup->addChild(std::move(amFrequencyParam));
+    
+    // Band split for harmonic tremolo
+    auto crossoverParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("crossoverFreq", 1),
+        "Harmonic Crossover",
+        juce::NormalisableRange<float>(80.0f, 5000.0f, 1.0f, 0.3f),
+        800.0f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(int(value)) + " Hz"; }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(80.0f, 5000.0f, text.getFloatValue());
+        }
+    );
+    tremoloGroup->addChild(std::move(crossoverParam));
+    
+    auto panWidthParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("panWidth", 1),
+        "Pan Width",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        1.0f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(int(value * 100)) + "%"; }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(0.0f, 1.0f, text.getFloatValue() / 100.0f);
+        }
+    );
+    lfoGroup->addChild(std::move(panWidthParam));
+    
+    // Right channel phase relative to the left; 180 degrees turns the pan back into tremolo
+    auto panOffsetParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("panStereoOffset", 1),
+        "Pan Stereo Offset",
+        juce::NormalisableRange<float>(-180.0f, 180.0f, 1.0f),
+        0.0f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(int(value)) + juce::String(juce::CharPointer_UTF8("°")); }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(-180.0f, 180.0f, text.getFloatValue());
+        }
+    );
+    lfoGroup->addChild(std::move(panOffsetParam));
     
     // Mix Control
     auto mixParam = std::make_unique<juce::AudioParameterFloat>(
@@ -540,6 +838,15 @@ juce::AudioProcessorValueTreeState::ParameterLayout QuackerVSTAudioProcessor::cr
     );
     utilityGroup->addChild(std::move(bypassParam));
 
+    // Instances in the same link group share one LFO
+    auto linkGroupParam = std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID("linkGroup", 1),
+        "Link Group",
+        juce::StringArray{ "Off", "1", "2", "3", "4", "5", "6", "7", "8" },
+        0
+    );
+    utilityGroup->addChild(std::move(linkGroupParam));
+
     // Waveshaping parameters with validation
     auto waveshapeRateParam = std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID("waveshapeRate", 1),
@@ -590,11 +897,141 @@ juce::AudioProcessorValueTreeState::ParameterLayout QuackerVSTAudioProcessor::cr
     );
     waveshapeGroup->addChild(std::move(waveshapeEnabledParam));
 
+    // Envelope follower
+    auto envModeParam = std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID("envMode", 1),
+        "Envelope Mode",
+        juce::StringArray{ "Peak", "RMS" },
+        0
+    );
+    dynamicsGroup->addChild(std::move(envModeParam));
+    
+    auto envAttackParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("envAttack", 1),
+        "Envelope Attack",
+        juce::NormalisableRange<float>(EnvelopeFollower::MIN_ATTACK_MS, EnvelopeFollower::MAX_ATTACK_MS, 0.1f, 0.4f),
+        10.0f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(value, 1) + " ms"; }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(EnvelopeFollower::MIN_ATTACK_MS, EnvelopeFollower::MAX_ATTACK_MS, text.getFloatValue());
+        }
+    );
+    dynamicsGroup->addChild(std::move(envAttackParam));
+    
+    auto envReleaseParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("envRelease", 1),
+        "Envelope Release",
+        juce::NormalisableRange<float>(EnvelopeFollower::MIN_RELEASE_MS, EnvelopeFollower::MAX_RELEASE_MS, 1.0f, 0.4f),
+        150.0f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(int(value)) + " ms"; }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(EnvelopeFollower::MIN_RELEASE_MS, EnvelopeFollower::MAX_RELEASE_MS, text.getFloatValue());
+        }
+    );
+    dynamicsGroup->addChild(std::move(envReleaseParam));
+    
+    // How much quiet playing pulls the depth down; at 100% the depth follows the level
+    auto envToDepthParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("envToDepth", 1),
+        "Envelope to Depth",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        0.0f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(int(value * 100)) + "%"; }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(0.0f, 1.0f, text.getFloatValue() / 100.0f);
+        }
+    );
+    dynamicsGroup->addChild(std::move(envToDepthParam));
+    
+    // Bipolar; ignored while the LFO is synced to the host
+    auto envToRateParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("envToRate", 1),
+        "Envelope to Rate",
+        juce::NormalisableRange<float>(-1.0f, 1.0f, 0.01f),
+        0.0f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(int(value * 100)) + "%"; }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(-1.0f, 1.0f, text.getFloatValue() / 100.0f);
+        }
+    );
+    dynamicsGroup->addChild(std::move(envToRateParam));
+
+    // Restart Pulse Decay, Guitar Pick and Slow Gear on each picked note
+    auto retriggerParam = std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("retrigger", 1),
+        "Retrigger on Attack",
+        true
+    );
+    dynamicsGroup->addChild(std::move(retriggerParam));
+    
+    auto onsetSensitivityParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("onsetSensitivity", 1),
+        "Attack Sensitivity",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        0.5f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(int(value * 100)) + "%"; }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(0.0f, 1.0f, text.getFloatValue() / 100.0f);
+        }
+    );
+    dynamicsGroup->addChild(std::move(onsetSensitivityParam));
+    
+    // Shortest gap between two retriggers, so one pick can't fire twice
+    auto onsetRefractoryParam = std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("onsetRefractory", 1),
+        "Attack Hold-Off",
+        juce::NormalisableRange<float>(EnvelopeFollower::MIN_REFRACTORY_MS, EnvelopeFollower::MAX_REFRACTORY_MS, 1.0f, 0.5f),
+        120.0f,
+        "",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(int(value)) + " ms"; }, // Keep suffix here
+        [](const juce::String& text) {
+            return juce::jlimit(EnvelopeFollower::MIN_REFRACTORY_MS, EnvelopeFollower::MAX_REFRACTORY_MS, text.getFloatValue());
+        }
+    );
+    dynamicsGroup->addChild(std::move(onsetRefractoryParam));
+
+    // MIDI control
+    auto midiRetriggerParam = std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("midiRetrigger", 1),
+        "MIDI Note Retrigger",
+        false
+    );
+    midiGroup->addChild(std::move(midiRetriggerParam));
+    
+    // Tremolo only while a MIDI note is held
+    auto midiGateParam = std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("midiGate", 1),
+        "MIDI Depth Gate",
+        false
+    );
+    midiGroup->addChild(std::move(midiGateParam));
+    
+    // Only used when the host gives no tempo
+    auto midiClockParam = std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("midiClockSync", 1),
+        "MIDI Clock Sync",
+        true
+    );
+    midiGroup->addChild(std::move(midiClockParam));
+
     // Create the layout with all parameter groups
     juce::AudioProcessorValueTreeState::ParameterLayout layout;
     layout.add(std::move(lfoGroup),
                std::move(tremoloGroup),
                std::move(waveshapeGroup),
+               std::move(dynamicsGroup),
+               std::move(midiGroup),
                std::move(utilityGroup));
 
     return layout;
@@ -636,6 +1073,69 @@ void QuackerVSTAudioProcessor::syncParametersAfterPresetLoad()
     if (syncParam) {
         wasInSync = !(syncParam->load() > 0.5f);
     }
+    
+    restoreNonParameterState();
+}
+
+void QuackerVSTAudioProcessor::setStepPattern(const StepSequencer::Pattern& newPattern)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(stateLock);
+    stepSequencer.setPattern(newPattern);
+    storeStateChild(StepSequencer::patternToValueTree(stepSequencer.getPattern()));
+}
+
+void QuackerVSTAudioProcessor::setCustomShape(const CustomWaveform::Shape& newShape)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(stateLock);
+    customWaveform.setShape(newShape);
+    storeStateChild(CustomWaveform::shapeToValueTree(customWaveform.getShape()));
+}
+
+void QuackerVSTAudioProcessor::storeStateChild(const juce::ValueTree& child)
+{
+    const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(stateLock);
+    auto existing = apvts.state.getChildWithName(child.getType());
+    
+    if (existing.isValid()) {
+        existing.copyPropertiesFrom(child, nullptr);
+    } else {
+        apvts.state.appendChild(child, nullptr);
+    }
+}
+
+void QuackerVSTAudioProcessor::restoreNonParameterState()
+{
+    // Hosts may restore state from any thread, but the sequencer and custom waveform each
+    // publish to the audio thread from a single producer. Without a message loop, as in the
+    // batch renderer, the caller is the only thread that touches them.
+    if (juce::MessageManager::getInstanceWithoutCreating() == nullptr
+        || juce::MessageManager::existsAndIsCurrentThread()) {
+        cancelPendingUpdate();
+        applyNonParameterState();
+    } else {
+        triggerAsyncUpdate();
+    }
+}
+
+void QuackerVSTAudioProcessor::applyNonParameterState()
+{
+    juce::ValueTree patternState, shapeState;
+    {
+        const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(stateLock);
+        patternState = apvts.state.getChildWithName(StepSequencer::patternType).createCopy();
+        shapeState = apvts.state.getChildWithName(CustomWaveform::shapeType).createCopy();
+    }
+    
+    // States saved before patterns or custom shapes existed fall back to the defaults
+    stepSequencer.setPattern(StepSequencer::patternFromValueTree(patternState));
+    customWaveform.setShape(CustomWaveform::shapeFromValueTree(shapeState));
+}
+
+void QuackerVSTAudioProcessor::handleAsyncUpdate()
+{
+    applyNonParameterState();
 }
 
 void QuackerVSTAudioProcessor::parameterValueChanged(int parameterIndex, float newValue)
@@ -647,7 +1147,7 @@ void QuackerVSTAudioProcessor::parameterValueChanged(int parameterIndex, float n
 // Helper method implementations
 void QuackerVSTAudioProcessor::reportError(ProcessorError::Type type, const juce::String& message) noexcept
 {
-    const juce::ScopedLock sl(errorLock);
+    const RealtimeSafetyChecker::CheckedLock::ScopedLockType sl(errorLock);
     lastError.type = type;
     lastError.message = message;
     lastError.timestamp = juce::Time::getCurrentTime();
@@ -665,9 +1165,22 @@ bool QuackerVSTAudioProcessor::validateAudioSpecs(double sampleRate, int samples
 
 bool QuackerVSTAudioProcessor::allocateLFOBuffer(int samplesPerBlock) noexcept
 {
+    // HeapBlock allocates with malloc, which the checker's operator new hook never sees
+    RealtimeSafetyChecker::report(RealtimeSafetyChecker::Violation::Allocation, "LFO buffers");
+    
     try {
-        lfoValuesBuffer.allocate(samplesPerBlock + 4, true);
-        lfoBufferSize = samplesPerBlock + 4;
+        const size_t size = static_cast<size_t>(samplesPerBlock + 4);
+        
+        lfoValuesBuffer.allocate(size, true);
+        lfoPhaseBuffer.allocate(size, true);
+        lfoDepthBuffer.allocate(size, true);
+        channelGainBuffer.allocate(size * ChannelPhaseSpread::MAX_CHANNELS, true);
+        
+        for (int channel = 0; channel < ChannelPhaseSpread::MAX_CHANNELS; ++channel) {
+            channelGains[channel] = channelGainBuffer.get() + size * static_cast<size_t>(channel);
+        }
+        
+        lfoBufferSize = size;
         return true;
     }
     catch (...) {
@@ -676,6 +1189,135 @@ bool QuackerVSTAudioProcessor::allocateLFOBuffer(int samplesPerBlock) noexcept
     }
 }
 
+void QuackerVSTAudioProcessor::renderLFO(int numSamples, bool withPhaseAndDepth) noexcept
+{
+    // One-shot waveforms restart on the exact sample of each detected attack
+    const int numOnsets = (retriggerOnOnsets && TremoloLFO::isOneShot(lfo.getWaveform()))
+                              ? envelopeFollower.getNumOnsets() : 0;
+    const int numMidiEvents = midiController.getNumEvents();
+    int onset = 0;
+    int midiEvent = 0;
+    int start = 0;
+    bool gateOpen = midiController.isGateOpenAtStart();
+    
+    // Automated controls are stepped every sub-block; settled ones don't split the block at all
+    const bool automating = depthAutomation.isMoving() || rateAutomation.isMoving()
+                            || phaseOffsetAutomation.isMoving();
+    int nextSplit = automating ? juce::jmin(automationSubBlockSize, numSamples) : numSamples;
+    
+    // Each sub-block heads for where the block-long ramp is at its last sample,
+    // so the final one arrives at the new value exactly
+    auto stepAutomation = [&](int subBlockEnd) {
+        const float fraction = static_cast<float>(subBlockEnd) / static_cast<float>(numSamples);
+        lfoDepthTarget = depthAutomation.at(fraction);
+        
+        if (gateOpen) {
+            lfo.setDepth(lfoDepthTarget);
+        }
+        
+        if (rateAutomation.isMoving()) {
+            lfo.setRate(rateAutomation.at(fraction));
+        }
+        
+        if (phaseOffsetAutomation.isMoving()) {
+            lfo.setPhaseOffset(phaseOffsetAutomation.at(fraction));
+        }
+    };
+    
+    if (automating) {
+        stepAutomation(nextSplit);
+    }
+    
+    // The event lists and the splits are all in order, so the block is rendered in runs between them
+    for (;;) {
+        int end = nextSplit;
+        
+        if (onset < numOnsets) {
+            end = juce::jmin(end, envelopeFollower.getOnset(onset));
+        }
+        
+        if (midiEvent < numMidiEvents) {
+            end = juce::jmin(end, midiController.getEvent(midiEvent).sample);
+        }
+        
+        if (withPhaseAndDepth) {
+            for (int i = start; i < end; ++i) {
+                lfoValuesBuffer[i] = lfo.getNextSample();
+                lfoPhaseBuffer[i] = static_cast<float>(lfo.getCurrentPhase());
+                lfoDepthBuffer[i] = lfo.getRunningDepth();
+            }
+        } else {
+            for (int i = start; i < end; ++i) {
+                lfoValuesBuffer[i] = lfo.getNextSample();
+            }
+        }
+        
+        if (end == numSamples) {
+            break;
+        }
+        
+        if (end == nextSplit) {
+            nextSplit = juce::jmin(numSamples, nextSplit + automationSubBlockSize);
+            stepAutomation(nextSplit);
+        }
+        
+        while (onset < numOnsets && envelopeFollower.getOnset(onset) == end) {
+            lfo.retrigger();
+            ++onset;
+        }
+        
+        while (midiEvent < numMidiEvents && midiController.getEvent(midiEvent).sample == end) {
+            switch (midiController.getEvent(midiEvent).type) {
+                case MidiLFOController::EventType::Retrigger:
+                    lfo.retrigger();
+                    break;
+                case MidiLFOController::EventType::GateOpen:
+                    gateOpen = true;
+                    lfo.setDepth(lfoDepthTarget);
+                    break;
+                case MidiLFOController::EventType::GateClose:
+                    gateOpen = false;
+                    lfo.setDepth(0.0f);
+                    break;
+            }
+            ++midiEvent;
+        }
+        
+        start = end;
+    }
+}
+
+void QuackerVSTAudioProcessor::renderLinkedLFO(int numSamples, bool withPhaseAndDepth, juce::int64 hostPosition) noexcept
+{
+    // Without a running transport there's no shared timeline to line blocks up on
+    if (linkGroup < 0 || hostPosition < 0 || numSamples > LFOLinkGroups::MAX_BLOCK_SIZE) {
+        renderLFO(numSamples, withPhaseAndDepth);
+        return;
+    }
+    
+    // A leader that hasn't published for two of our blocks has stopped rendering its LFO, so one of us takes over
+    const auto now = juce::Time::getHighResolutionTicks();
+    const auto staleAfter = juce::Time::secondsToHighResolutionTicks(2.0 * numSamples / currentSpecs.sampleRate);
+    
+    if (linkGroups->lead(linkGroup, this, now, staleAfter)) {
+        // Other members may need the phases and depths even when this instance doesn't
+        renderLFO(numSamples, true);
+        linkGroups->publish(linkGroup, hostPosition, lfoValuesBuffer, lfoPhaseBuffer, lfoDepthBuffer,
+                            numSamples, lfo.getCyclePosition(), now);
+        return;
+    }
+    
+    double cyclePosition = 0.0;
+    
+    if (linkGroups->read(linkGroup, hostPosition, lfoValuesBuffer, lfoPhaseBuffer, lfoDepthBuffer,
+                         numSamples, cyclePosition)) {
+        // Keep our own LFO on the leader's phase, for blocks the leader hasn't published in time
+        lfo.setCyclePosition(cyclePosition);
+    } else {
+        renderLFO(numSamples, withPhaseAndDepth);
+    }
+}
+
 void QuackerVSTAudioProcessor::processParameterUpdates() noexcept
 {
     try {
@@ -700,6 +1342,62 @@ void QuackerVSTAudioProcessor::processParameterUpdates() noexcept
         float rate = rateParam->load();
         int division = static_cast<int>(divisionParam->load());
         
+        auto* retriggerParam = apvts.getRawParameterValue("retrigger");
+        auto* onsetSensitivityParam = apvts.getRawParameterValue("onsetSensitivity");
+        auto* onsetRefractoryParam = apvts.getRawParameterValue("onsetRefractory");
+        
+        if (retriggerParam && onsetSensitivityParam && onsetRefractoryParam) {
+            retriggerOnOnsets = retriggerParam->load() > 0.5f;
+            envelopeFollower.setOnsetSensitivity(onsetSensitivityParam->load());
+            envelopeFollower.setRefractoryPeriod(onsetRefractoryParam->load());
+        }
+        
+        auto* midiRetriggerParam = apvts.getRawParameterValue("midiRetrigger");
+        auto* midiGateParam = apvts.getRawParameterValue("midiGate");
+        auto* midiClockParam = apvts.getRawParameterValue("midiClockSync");
+        
+        if (midiRetriggerParam && midiGateParam && midiClockParam) {
+            midiController.setRetriggerOnNotes(midiRetriggerParam->load() > 0.5f);
+            midiController.setGateEnabled(midiGateParam->load() > 0.5f);
+            midiClockSync = midiClockParam->load() > 0.5f;
+        }
+        
+        if (auto* linkGroupParam = apvts.getRawParameterValue("linkGroup")) {
+            const int newLinkGroup = juce::jlimit(0, LFOLinkGroups::NUM_GROUPS, static_cast<int>(linkGroupParam->load())) - 1;
+            
+            if (newLinkGroup != linkGroup) {
+                linkGroups->leave(linkGroup, this);
+                linkGroup = newLinkGroup;
+            }
+        }
+        
+        // Dynamics: the envelope scales depth down and pushes the free-running rate up or down
+        auto* envModeParam = apvts.getRawParameterValue("envMode");
+        auto* envAttackParam = apvts.getRawParameterValue("envAttack");
+        auto* envReleaseParam = apvts.getRawParameterValue("envRelease");
+        auto* envToDepthParam = apvts.getRawParameterValue("envToDepth");
+        auto* envToRateParam = apvts.getRawParameterValue("envToRate");
+        float envToRate = 0.0f;
+        
+        if (envModeParam && envAttackParam && envReleaseParam && envToDepthParam && envToRateParam) {
+            envelopeFollower.setMode(static_cast<EnvelopeFollower::Mode>(juce::jlimit(0, 1, static_cast<int>(envModeParam->load()))));
+            envelopeFollower.setAttack(envAttackParam->load());
+            envelopeFollower.setRelease(envReleaseParam->load());
+            
+            const float level = envelopeFollower.getLevel();
+            depth *= 1.0f - envToDepthParam->load() * (1.0f - level);
+            envToRate = envToRateParam->load() * level;
+        }
+        
+        // Automation only arrives once per block, so renderLFO ramps the LFO from the last block's depth.
+        // The MIDI gate holds the depth at zero until a note is down; mid-block changes happen in renderLFO
+        depthAutomation.moveTo(depth);
+        lfoDepthTarget = depthAutomation.start;
+        
+        if (!midiController.isGateOpenAtStart()) {
+            depth = 0.0f;
+        }
+        
         // Update waveshaping
         auto* waveshapeRateParam = apvts.getRawParameterValue("waveshapeRate");
         auto* waveshapeDepthParam = apvts.getRawParameterValue("waveshapeDepth");
@@ -718,10 +1416,63 @@ void QuackerVSTAudioProcessor::processParameterUpdates() noexcept
                                      waveshapeWaveform, waveshapeEnabled);
         }
         
-        // Set LFO parameters
+        // Set LFO parameters; morphing first, so a morph keeps the waveform choice from resetting the phase
+        auto* morphParam = apvts.getRawParameterValue("lfoMorph");
+        auto* shapeParam = apvts.getRawParameterValue("lfoShape");
+        
+        if (morphParam && shapeParam) {
+            const bool morphing = morphParam->load() > 0.5f;
+            
+            // Start where the LFO starts, from the selected waveform
+            if (morphing && !lfo.isMorphEnabled()) {
+                parameterSmoothers.setCurrentAndTargetValue(MorphLane, static_cast<float>(lfo.getWaveform()));
+            }
+            
+            lfo.setMorphEnabled(morphing);
+            lfo.setMorphPosition(shapeParam->load());
+            parameterSmoothers.setTargetValue(MorphLane, juce::jlimit(0.0f, TremoloLFO::MAX_MORPH_POSITION, shapeParam->load()));
+        }
+        
         lfo.setWaveform(static_cast<TremoloLFO::Waveform>(static_cast<int>(waveform)));
-        lfo.setDepth(depth);
-        lfo.setPhaseOffset(phaseOffset);
+        lfo.setDepth(midiController.isGateOpenAtStart() ? depthAutomation.start : 0.0f);
+        phaseOffsetAutomation.moveTo(phaseOffset);
+        lfo.setPhaseOffset(phaseOffsetAutomation.start);
+        
+        if (auto* channelSpreadParam = apvts.getRawParameterValue("channelSpread")) {
+            channelSpread.setSpread(channelSpreadParam->load());
+            channelSpread.setWaveform(lfo.getWaveform());
+        }
+        
+        auto* modeParam = apvts.getRawParameterValue("lfoMode");
+        auto* panWidthParam = apvts.getRawParameterValue("panWidth");
+        auto* panOffsetParam = apvts.getRawParameterValue("panStereoOffset");
+        
+        if (modeParam && panWidthParam && panOffsetParam) {
+            lfoMode = static_cast<LFOMode>(juce::jlimit(0, 5, static_cast<int>(modeParam->load())));
+            autoPanner.setWidth(panWidthParam->load());
+            autoPanner.setStereoOffset(panOffsetParam->load());
+            autoPanner.setWaveform(lfo.getWaveform());
+        }
+        
+        updateReportedLatency();
+        
+        if (auto* crossoverParam = apvts.getRawParameterValue("crossoverFreq")) {
+            harmonicTremolo.setCrossoverFrequency(crossoverParam->load());
+        }
+        
+        if (auto* stepDivisionParam = apvts.getRawParameterValue("seqStepDivision")) {
+            const double stepsPerQuarter[] = { 1.0, 2.0, 4.0, 8.0 };
+            stepSequencer.setStepsPerQuarter(stepsPerQuarter[juce::jlimit(0, 3, static_cast<int>(stepDivisionParam->load()))]);
+            stepSequencer.setDepth(depth);
+        }
+        
+        if (auto* amFrequencyParam = apvts.getRawParameterValue("amFrequency")) {
+            audioRateModulator.setFrequency(amFrequencyParam->load());
+            audioRateModulator.setDepth(depth);
+            audioRateModulator.setWaveform(lfo.getWaveform());
+            audioRateModulator.setMorph(lfo.isMorphEnabled(), parameterSmoothers.getCurrentValue(MorphLane));
+            audioRateModulator.setRingMod(lfoMode == LFOMode::RingMod);
+        }
         
         // Handle sync mode changes
         if (isInSync != wasInSync) {
@@ -764,13 +1515,17 @@ void QuackerVSTAudioProcessor::processParameterUpdates() noexcept
             syncedFreq = juce::jlimit(0.01, 25.0, syncedFreq);
             
             lfo.setRate(static_cast<float>(syncedFreq));
+            rateAutomation.jumpTo(static_cast<float>(syncedFreq));
             
             if (auto* rateParameter = apvts.getParameter("lfoRate")) {
                 rateParameter->setValueNotifyingHost(
                     rateParameter->convertTo0to1(static_cast<float>(syncedFreq)));
             }
         } else {
-            lfo.setRate(rate);
+            // Up to an octave either way at full level
+            float dynamicRate = envToRate != 0.0f ? rate * std::exp2(envToRate) : rate;
+            rateAutomation.moveTo(juce::jlimit(0.01f, 25.0f, dynamicRate));
+            lfo.setRate(rateAutomation.start);
         }
     }
     catch (...) {
@@ -778,6 +1533,68 @@ void QuackerVSTAudioProcessor::processParameterUpdates() noexcept
     }
 }
 
+void QuackerVSTAudioProcessor::applyQualityTier(QualityGovernor::Tier tier) noexcept
+{
+    using Tier = QualityGovernor::Tier;
+    
+    const auto precision = tier == Tier::Maximum  ? FastMath::Precision::High
+                         : tier == Tier::Standard ? FastMath::Precision::Medium
+                                                  : FastMath::Precision::Low;
+    
+    lfo.setPrecision(precision);
+    lfo.setOversamplingEnabled(tier >= Tier::Standard);
+    lfo.setControlInterval(tier == Tier::Economy ? economyControlInterval : 1);
+    
+    appliedQualityTier = tier;
+}
+
+void QuackerVSTAudioProcessor::updateReportedLatency() noexcept
+{
+    // AM and ring mod report the oversampler's delay for as long as they're selected, whichever
+    // path is playing, so the host's compensation doesn't jump when the rate crosses the threshold
+    const bool audioRateMode = lfoMode == LFOMode::AudioRateAM || lfoMode == LFOMode::RingMod;
+    const int latency = audioRateMode ? audioRateModulator.getLatencySamples() : 0;
+
+    if (latency != getLatencySamples()) {
+        // Entering the mode: don't play out whatever the delay line held from the last time
+        if (audioRateMode) {
+            audioRateModulator.reset();
+        }
+
+        setLatencySamples(latency);
+    }
+}
+
+const float* QuackerVSTAudioProcessor::updateMorphedTable(const float* customTable) noexcept
+{
+    const float position = parameterSmoothers.getCurrentValue(MorphLane);
+
+    if (position == morphedTablePosition && customTable == morphedTableCustom) {
+        return morphedTable;
+    }
+
+    // Same crossfade as TremoloLFO::calculateMorphedValue, baked for the block
+    const int lower = std::min(static_cast<int>(position), static_cast<int>(TremoloLFO::NumWaveforms) - 2);
+    const float blend = position - static_cast<float>(lower);
+
+    auto tableFor = [customTable](int shape) {
+        return (shape == TremoloLFO::Custom && customTable != nullptr)
+                   ? customTable
+                   : LFOBank::getWaveformTable(static_cast<TremoloLFO::Waveform>(shape));
+    };
+
+    const float* from = tableFor(lower);
+    const float* to = tableFor(lower + 1);
+
+    for (int i = 0; i <= LFOBank::TABLE_SIZE; ++i) {
+        morphedTable[i] = from[i] + blend * (to[i] - from[i]);
+    }
+
+    morphedTablePosition = position;
+    morphedTableCustom = customTable;
+    return morphedTable;
+}
+
 bool QuackerVSTAudioProcessor::validateParameterValue(const juce::String& paramID, float value) const noexcept
 {
     if (paramID == "lfoRate" || paramID == "waveshapeRate") {
@@ -789,7 +1606,58 @@ bool QuackerVSTAudioProcessor::validateParameterValue(const juce::String& paramI
     else if (paramID == "lfoPhaseOffset") {
         return value >= -180.0f && value <= 180.0f;
     }
-    else if (paramID == "lfoWaveform" || paramID == "waveshapeWaveform") {
+    else if (paramID == "channelSpread") {
+        return value >= 0.0f && value <= 360.0f;
+    }
+    else if (paramID == "panWidth") {
+        return value >= 0.0f && value <= 1.0f;
+    }
+    else if (paramID == "panStereoOffset") {
+        return value >= -180.0f && value <= 180.0f;
+    }
+    else if (paramID == "linkGroup") {
+        return value >= 0.0f && value <= static_cast<float>(LFOLinkGroups::NUM_GROUPS); // Off, then the groups
+    }
+    else if (paramID == "lfoMode") {
+        return value >= 0.0f && value < 6.0f; // 6 modes
+    }
+    else if (paramID == "seqStepDivision") {
+        return value >= 0.0f && value < 4.0f; // 4 divisions
+    }
+    else if (paramID == "amFrequency") {
+        return value >= AudioRateModulator::MIN_FREQUENCY && value <= AudioRateModulator::MAX_FREQUENCY;
+    }
+    else if (paramID == "envMode") {
+        return value >= 0.0f && value < 2.0f; // Peak, RMS
+    }
+    else if (paramID == "envAttack") {
+        return value >= EnvelopeFollower::MIN_ATTACK_MS && value <= EnvelopeFollower::MAX_ATTACK_MS;
+    }
+    else if (paramID == "envRelease") {
+        return value >= EnvelopeFollower::MIN_RELEASE_MS && value <= EnvelopeFollower::MAX_RELEASE_MS;
+    }
+    else if (paramID == "envToDepth") {
+        return value >= 0.0f && value <= 1.0f;
+    }
+    else if (paramID == "envToRate") {
+        return value >= -1.0f && value <= 1.0f;
+    }
+    else if (paramID == "onsetSensitivity") {
+        return value >= 0.0f && value <= 1.0f;
+    }
+    else if (paramID == "onsetRefractory") {
+        return value >= EnvelopeFollower::MIN_REFRACTORY_MS && value <= EnvelopeFollower::MAX_REFRACTORY_MS;
+    }
+    else if (paramID == "crossoverFreq") {
+        return value >= 80.0f && value <= 5000.0f;
+    }
+    else if (paramID == "lfoWaveform") {
+        return value >= 0.0f && value < 20.0f; // 19 waveforms plus Custom
+    }
+    else if (paramID == "lfoShape") {
+        return value >= 0.0f && value <= TremoloLFO::MAX_MORPH_POSITION;
+    }
+    else if (paramID == "waveshapeWaveform") {
         return value >= 0.0f && value < 19.0f; // 19 waveforms
     }
     else if (paramID == "lfoNoteDivision") {
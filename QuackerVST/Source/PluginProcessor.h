@@ -10,10 +10,23 @@
 
 #include <JuceHeader.h>
 #include "TremoloLFO.h"
+#include "ChannelPhaseSpread.h"
+#include "AutoPanner.h"
+#include "HarmonicTremolo.h"
+#include "AudioRateModulator.h"
+#include "EnvelopeFollower.h"
+#include "MidiLFOController.h"
+#include "StepSequencer.h"
+#include "CustomWaveform.h"
+#include "SmoothedParameterBank.h"
+#include "QualityGovernor.h"
+#include "LFOLinkGroups.h"
+#include "RealtimeSafetyChecker.h"
 #include "PresetManager.h"
 
 class QuackerVSTAudioProcessor : public juce::AudioProcessor,
-                                 public juce::AudioProcessorParameter::Listener {
+                                 public juce::AudioProcessorParameter::Listener,
+                                 private juce::AsyncUpdater {
 public:
     QuackerVSTAudioProcessor();
     ~QuackerVSTAudioProcessor() override;
@@ -26,6 +39,8 @@ public:
    #endif
 
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override { return true; }
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override;
     const juce::String getName() const override;
@@ -65,6 +80,14 @@ public:
     bool isLfoWaitingForReset() const noexcept { return lfo.isWaitingForReset(); }
     
     PresetManager& getPresetManager() noexcept { return *presetManager; }
+    
+    // Message thread only; the pattern is kept in the state so presets carry it
+    void setStepPattern(const StepSequencer::Pattern& newPattern);
+    const StepSequencer::Pattern& getStepPattern() const noexcept { return stepSequencer.getPattern(); }
+    
+    // Message thread only; compiles the drawn shape and keeps it in the state
+    void setCustomShape(const CustomWaveform::Shape& newShape);
+    const CustomWaveform& getCustomWaveform() const noexcept { return customWaveform; }
     void loadFactoryPresets();
     void applyParametersInOrder();
     void syncParametersAfterPresetLoad();
@@ -87,12 +110,12 @@ public:
     };
     
     ProcessorError getLastError() const noexcept {
-        const juce::ScopedLock sl(errorLock);
+        const RealtimeSafetyChecker::CheckedLock::ScopedLockType sl(errorLock);
         return lastError;
     }
     
     void clearError() noexcept {
-        const juce::ScopedLock sl(errorLock);
+        const RealtimeSafetyChecker::CheckedLock::ScopedLockType sl(errorLock);
         lastError = ProcessorError();
     }
 
@@ -100,9 +123,80 @@ private:
     // DC Filter components
     juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>,
                                   juce::dsp::IIR::Coefficients<float>> dcFilter;
+    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<double>,
+                                  juce::dsp::IIR::Coefficients<double>> doublePrecisionDCFilter;
     juce::dsp::ProcessSpec currentSpecs;
     
     TremoloLFO lfo;
+    ChannelPhaseSpread channelSpread;
+    AutoPanner autoPanner;
+    HarmonicTremolo harmonicTremolo;
+    AudioRateModulator audioRateModulator;
+    EnvelopeFollower envelopeFollower;
+    MidiLFOController midiController;
+    StepSequencer stepSequencer;
+    CustomWaveform customWaveform;
+    
+    // Controls applied outside the LFO; the LFO smooths its own
+    enum SmoothedLane {
+        MixLane,
+        MorphLane   // Follows the LFO's morph ramp for the paths that read a table instead
+    };
+    SmoothedParameterBank parameterSmoothers;
+    
+    // The LFO's morph crossfade as one table, for channel spread and auto-pan; rebuilt only when it changes
+    float morphedTable[LFOBank::TABLE_SIZE + 1] = {};
+    float morphedTablePosition = -1.0f;
+    const float* morphedTableCustom = nullptr;
+    
+    // Trades LFO precision for headroom when blocks run close to their deadline
+    QualityGovernor qualityGovernor;
+    QualityGovernor::Tier appliedQualityTier = QualityGovernor::Tier::Standard;
+    
+    // Opt-in LFO sharing with other instances; -1 when this instance isn't linked
+    juce::SharedResourcePointer<LFOLinkGroups> linkGroups;
+    int linkGroup = -1;
+    
+    // Matches the order of the lfoMode choices
+    enum class LFOMode {
+        Tremolo = 0,
+        AutoPan,
+        Harmonic,
+        AudioRateAM,
+        RingMod,
+        Pattern
+    };
+    LFOMode lfoMode = LFOMode::Tremolo;
+    bool retriggerOnOnsets = true;
+    bool midiClockSync = true;
+    float lfoDepthTarget = 0.5f;  // Depth before the MIDI gate, restored when it opens mid-block
+    
+    // Host automation only reaches us once per block. Each control ramps from the
+    // previous block's value to the new one, stepped every sub-block in renderLFO,
+    // so fast automation at large buffer sizes doesn't staircase. A sub-block
+    // takes the ramp's value at its end, so the block finishes on `end`.
+    struct AutomationRamp {
+        float start = 0.0f;
+        float end = 0.0f;
+        bool primed = false;
+        
+        void moveTo(float value) noexcept {
+            start = primed ? end : value;
+            end = value;
+            primed = true;
+        }
+        
+        void jumpTo(float value) noexcept {
+            start = end = value;
+            primed = true;
+        }
+        
+        bool isMoving() const noexcept { return start != end; }
+        float at(float fraction) const noexcept { return start + (end - start) * fraction; }
+    };
+    AutomationRamp depthAutomation;
+    AutomationRamp rateAutomation;
+    AutomationRamp phaseOffsetAutomation;
     
     // Thread-safe atomic values
     std::atomic<double> currentBPM{120.0};
@@ -111,28 +205,56 @@ private:
     std::atomic<bool> audioInputDetected{false};
     
     juce::HeapBlock<float> lfoValuesBuffer;
+    juce::HeapBlock<float> lfoPhaseBuffer;
+    juce::HeapBlock<float> lfoDepthBuffer;
+    juce::HeapBlock<float> channelGainBuffer;
+    float* channelGains[ChannelPhaseSpread::MAX_CHANNELS] = {};
     size_t lfoBufferSize = 0;
     
+    // The audio-rate modulator oversamples in float, so 64-bit hosts convert through this in AM and ring mod
+    juce::AudioBuffer<float> audioRateConversionBuffer;
+    
     // Constants
     static constexpr double defaultBPM = 120.0;
     static constexpr double minValidBPM = 1.0;
     static constexpr double maxValidBPM = 999.0;
     static constexpr float audioDetectionThreshold = 0.0001f;
     static constexpr int maxBlockSize = 8192; // Safety limit
+    static constexpr int automationSubBlockSize = 128;
+    static constexpr int economyControlInterval = 16;
+    static constexpr int maxNumChannels = 12; // 7.1.4
     
     bool wasInSync = false;
     
     std::unique_ptr<PresetManager> presetManager;
     
+    // Serialises host state saves and restores with the editors writing the pattern and shape into apvts.state
+    RealtimeSafetyChecker::CheckedLock stateLock{ "stateLock" };
+    
     // Error handling
-    mutable juce::CriticalSection errorLock;
+    RealtimeSafetyChecker::CheckedLock errorLock{ "errorLock" };
     ProcessorError lastError;
     
     // Helper methods
     void reportError(ProcessorError::Type type, const juce::String& message) noexcept;
     bool validateAudioSpecs(double sampleRate, int samplesPerBlock) const noexcept;
     bool allocateLFOBuffer(int samplesPerBlock) noexcept;
+    void renderLFO(int numSamples, bool withPhaseAndDepth) noexcept;
+    void renderLinkedLFO(int numSamples, bool withPhaseAndDepth, juce::int64 hostPosition) noexcept;
+    
+    // Shared by both processBlock overloads, so 64-bit hosts are processed in place without conversion
+    template <typename SampleType>
+    void processSamples(juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages);
+    
+    // The pattern and shape have one producer, the message thread; restores from elsewhere are posted to it
+    void restoreNonParameterState();
+    void applyNonParameterState();
+    void handleAsyncUpdate() override;
+    void storeStateChild(const juce::ValueTree& child);
     void processParameterUpdates() noexcept;
+    void applyQualityTier(QualityGovernor::Tier tier) noexcept;
+    void updateReportedLatency() noexcept;
+    const float* updateMorphedTable(const float* customTable) noexcept;
     bool validateParameterValue(const juce::String& paramID, float value) const noexcept;
     
     // Safe parameter access
@@ -0,0 +1,317 @@
+/*
+  ==============================================================================
+
+    PresetBank.cpp
+    Created: 18 Oct 2026 10:12:41am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "PresetBank.h"
+
+namespace
+{
+    const char bankMagic[4] = { 'T', 'V', 'P', 'B' };
+
+    // Bounds-checked little-endian reader over the mapped index
+    struct IndexReader {
+        const char* data;
+        size_t size;
+        size_t position = 0;
+
+        bool canRead(size_t numBytes) const noexcept {
+            return position + numBytes <= size;
+        }
+
+        bool readUint32(juce::uint32& value) noexcept {
+            if (!canRead(4)) return false;
+            value = juce::ByteOrder::littleEndianInt(data + position);
+            position += 4;
+            return true;
+        }
+
+        bool readInt64(juce::int64& value) noexcept {
+            if (!canRead(8)) return false;
+            value = static_cast<juce::int64>(juce::ByteOrder::littleEndianInt64(data + position));
+            position += 8;
+            return true;
+        }
+
+        bool readString(juce::String& value, int maxBytes) {
+            if (!canRead(2)) return false;
+            auto numBytes = static_cast<size_t>(juce::ByteOrder::littleEndianShort(data + position));
+            position += 2;
+
+            if (numBytes > static_cast<size_t>(maxBytes) || !canRead(numBytes)) return false;
+            value = juce::String::fromUTF8(data + position, static_cast<int>(numBytes));
+            position += numBytes;
+            return true;
+        }
+    };
+
+    void writeString(juce::OutputStream& out, const juce::String& text, int maxBytes)
+    {
+        auto utf8 = text.toUTF8();
+        const auto* bytes = reinterpret_cast<const juce::uint8*>(utf8.getAddress());
+        const auto totalBytes = static_cast<int>(utf8.sizeInBytes()) - 1;
+        auto numBytes = juce::jmin(totalBytes, maxBytes);
+        
+        // Cut at the start of a character, never inside a multi-byte sequence
+        while (numBytes > 0 && numBytes < totalBytes && (bytes[numBytes] & 0xc0) == 0x80) {
+            --numBytes;
+        }
+        
+        out.writeShort(static_cast<short>(numBytes));
+        out.write(utf8.getAddress(), static_cast<size_t>(numBytes));
+    }
+}
+
+bool PresetBank::open(const juce::File& bankFile)
+{
+    file = bankFile;
+    entries.clear();
+    categories.clear();
+    mappedFile.reset();
+
+    if (!bankFile.existsAsFile() || !bankFile.hasReadAccess()) {
+        return fail("Preset bank not readable: " + bankFile.getFullPathName());
+    }
+
+    auto fileSize = bankFile.getSize();
+    if (fileSize < static_cast<juce::int64>(headerSize) || fileSize > MAX_BANK_FILE_SIZE) {
+        return fail("Preset bank has invalid size: " + bankFile.getFullPathName());
+    }
+
+    try {
+        mappedFile = std::make_unique<juce::MemoryMappedFile>(bankFile, juce::MemoryMappedFile::readOnly, false);
+
+        if (mappedFile->getData() == nullptr) {
+            mappedFile.reset();
+            return fail("Failed to map preset bank: " + bankFile.getFullPathName());
+        }
+
+        auto* data = static_cast<const char*>(mappedFile->getData());
+        if (!parseIndex(data, mappedFile->getSize())) {
+            mappedFile.reset();
+            entries.clear();
+            categories.clear();
+            return false;
+        }
+
+        lastErrorMessage.clear();
+        return true;
+    }
+    catch (const std::exception& e) {
+        mappedFile.reset();
+        return fail("Exception opening preset bank: " + juce::String(e.what()));
+    }
+}
+
+bool PresetBank::parseIndex(const char* data, size_t dataSize)
+{
+    if (std::memcmp(data, bankMagic, sizeof(bankMagic)) != 0) {
+        return fail("Not a preset bank: " + file.getFullPathName());
+    }
+
+    IndexReader header{ data, headerSize, sizeof(bankMagic) };
+    juce::uint32 version = 0, numCategories = 0, numPresets = 0, indexOffset = 0, indexSize = 0;
+
+    if (!header.readUint32(version) || !header.readUint32(numCategories) ||
+        !header.readUint32(numPresets) || !header.readUint32(indexOffset) ||
+        !header.readUint32(indexSize)) {
+        return fail("Truncated preset bank header");
+    }
+
+    if (version != formatVersion) {
+        return fail("Unsupported preset bank version: " + juce::String(version));
+    }
+
+    if (numPresets > static_cast<juce::uint32>(MAX_BANK_PRESETS) ||
+        numCategories > static_cast<juce::uint32>(MAX_BANK_PRESETS)) {
+        return fail("Preset bank index is too large");
+    }
+
+    if (indexOffset < headerSize ||
+        static_cast<size_t>(indexOffset) + static_cast<size_t>(indexSize) > dataSize) {
+        return fail("Preset bank index is out of range");
+    }
+
+    IndexReader reader{ data + indexOffset, indexSize };
+
+    // Category tree
+    for (juce::uint32 i = 0; i < numCategories; ++i) {
+        juce::String category;
+        if (!reader.readString(category, MAX_STRING_BYTES)) {
+            return fail("Corrupt category table in preset bank");
+        }
+        categories.add(category);
+    }
+
+    // Offset table
+    entries.reserve(numPresets);
+
+    for (juce::uint32 i = 0; i < numPresets; ++i) {
+        Entry entry;
+        juce::uint32 categoryIndex = 0;
+        juce::int64 dateMs = 0;
+
+        if (!reader.readUint32(entry.dataOffset) || !reader.readUint32(entry.dataSize) ||
+            !reader.readUint32(categoryIndex) || !reader.readInt64(dateMs) ||
+            !reader.readString(entry.name, MAX_STRING_BYTES)) {
+            return fail("Corrupt preset table in preset bank");
+        }
+
+        // Payload must sit between the header and the index
+        if (entry.dataOffset < headerSize || entry.dataSize == 0 ||
+            entry.dataSize > MAX_PRESET_DATA_SIZE ||
+            static_cast<size_t>(entry.dataOffset) + entry.dataSize > indexOffset) {
+            return fail("Preset data out of range for: " + entry.name);
+        }
+
+        if (categoryIndex >= numCategories) {
+            return fail("Invalid category for: " + entry.name);
+        }
+
+        entry.categoryIndex = static_cast<int>(categoryIndex);
+        entry.dateCreated = juce::Time(dateMs);
+        entries.push_back(std::move(entry));
+    }
+
+    return true;
+}
+
+juce::String PresetBank::getCategory(int index) const
+{
+    if (!juce::isPositiveAndBelow(index, getNumPresets())) {
+        return {};
+    }
+    return categories[getEntry(index).categoryIndex];
+}
+
+juce::ValueTree PresetBank::decodeState(int index) const
+{
+    if (mappedFile == nullptr || !juce::isPositiveAndBelow(index, getNumPresets())) {
+        return {};
+    }
+
+    const auto& entry = getEntry(index);
+    auto* data = static_cast<const char*>(mappedFile->getData());
+    return juce::ValueTree::readFromData(data + entry.dataOffset, entry.dataSize);
+}
+
+bool PresetBank::write(const juce::File& bankFile, const std::vector<Source>& presets,
+                       juce::String& errorMessage)
+{
+    if (presets.size() > static_cast<size_t>(MAX_BANK_PRESETS)) {
+        errorMessage = "Too many presets for a single bank";
+        return false;
+    }
+
+    try {
+        juce::MemoryOutputStream payload;
+        juce::MemoryOutputStream index;
+        juce::StringArray categoryTable;
+
+        struct PendingEntry {
+            juce::uint32 dataOffset;
+            juce::uint32 dataSize;
+            juce::uint32 categoryIndex;
+        };
+        std::vector<PendingEntry> pending;
+        pending.reserve(presets.size());
+
+        for (const auto& preset : presets) {
+            if (!preset.state.isValid()) {
+                continue;
+            }
+
+            auto offset = static_cast<juce::uint32>(headerSize + payload.getDataSize());
+            preset.state.writeToStream(payload);
+            auto size = static_cast<juce::uint32>(headerSize + payload.getDataSize()) - offset;
+
+            int categoryIndex = categoryTable.indexOf(preset.category);
+            if (categoryIndex < 0) {
+                categoryIndex = categoryTable.size();
+                categoryTable.add(preset.category);
+            }
+
+            pending.push_back({ offset, size, static_cast<juce::uint32>(categoryIndex) });
+        }
+
+        for (const auto& category : categoryTable) {
+            writeString(index, category, MAX_STRING_BYTES);
+        }
+
+        size_t entryNumber = 0;
+        for (const auto& preset : presets) {
+            if (!preset.state.isValid()) {
+                continue;
+            }
+
+            const auto& entry = pending[entryNumber++];
+            index.writeInt(static_cast<int>(entry.dataOffset));
+            index.writeInt(static_cast<int>(entry.dataSize));
+            index.writeInt(static_cast<int>(entry.categoryIndex));
+            index.writeInt64(preset.dateCreated.toMilliseconds());
+            writeString(index, preset.name, MAX_STRING_BYTES);
+        }
+
+        auto indexOffset = static_cast<juce::uint32>(headerSize + payload.getDataSize());
+
+        if (static_cast<juce::int64>(indexOffset) + static_cast<juce::int64>(index.getDataSize()) > MAX_BANK_FILE_SIZE) {
+            errorMessage = "Preset bank would exceed the maximum file size";
+            return false;
+        }
+
+        // Write to a temporary file first so a failed export never leaves a truncated bank
+        juce::TemporaryFile tempFile(bankFile);
+        {
+            juce::FileOutputStream out(tempFile.getFile());
+            if (!out.openedOk()) {
+                errorMessage = "Failed to open preset bank for writing: " + bankFile.getFullPathName();
+                return false;
+            }
+
+            out.write(bankMagic, sizeof(bankMagic));
+            out.writeInt(static_cast<int>(formatVersion));
+            out.writeInt(categoryTable.size());
+            out.writeInt(static_cast<int>(pending.size()));
+            out.writeInt(static_cast<int>(indexOffset));
+            out.writeInt(static_cast<int>(index.getDataSize()));
+            out.writeInt(0); // Reserved
+            out.writeInt(0); // Reserved
+
+            out.write(payload.getData(), payload.getDataSize());
+            out.write(index.getData(), index.getDataSize());
+            out.flush();
+
+            if (out.getStatus().failed()) {
+                errorMessage = "Failed to write preset bank: " + out.getStatus().getErrorMessage();
+                return false;
+            }
+        }
+
+        if (!tempFile.overwriteTargetFileWithTemporary()) {
+            errorMessage = "Failed to replace preset bank: " + bankFile.getFullPathName();
+            return false;
+        }
+
+        return true;
+    }
+    catch (const std::exception& e) {
+        errorMessage = "Exception writing preset bank: " + juce::String(e.what());
+        return false;
+    }
+}
+
+bool PresetBank::fail(const juce::String& message)
+{
+    lastErrorMessage = message;
+
+    #if JUCE_DEBUG
+    DBG("PresetBank Error: " + message);
+    #endif
+
+    return false;
+}
@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    PresetBank.h
+    Created: 18 Oct 2026 10:12:41am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+/**
+ * A single-file container holding many presets.
+ *
+ * The file is memory-mapped when opened and only the index (offset table and
+ * category list) is parsed up front. Individual preset states are decoded from
+ * the mapped data on demand, so opening a bank costs one mmap regardless of
+ * how many presets it holds.
+ *
+ * Layout (all integers little-endian):
+ *   Header   "TVPB", version, numCategories, numPresets, indexOffset, indexSize
+ *   Payload  ValueTree binary blobs, one per preset
+ *   Index    category paths, then one entry per preset
+ *            (dataOffset, dataSize, categoryIndex, dateCreated, name)
+ */
+class PresetBank
+{
+public:
+    // Preset data used when writing a bank
+    struct Source {
+        juce::String name;
+        juce::String category;
+        juce::ValueTree state;
+        juce::Time dateCreated;
+    };
+
+    // Decoded index entry - the state itself stays in the mapped payload
+    struct Entry {
+        juce::String name;
+        int categoryIndex = 0;
+        juce::Time dateCreated;
+        juce::uint32 dataOffset = 0;
+        juce::uint32 dataSize = 0;
+    };
+
+    PresetBank() = default;
+    ~PresetBank() = default;
+
+    // Maps the file and parses its index. Returns false if the file is not a valid bank.
+    bool open(const juce::File& bankFile);
+
+    // Serializes the given presets into a new bank file, replacing any existing one
+    static bool write(const juce::File& bankFile, const std::vector<Source>& presets,
+                      juce::String& errorMessage);
+
+    int getNumPresets() const noexcept { return static_cast<int>(entries.size()); }
+    const Entry& getEntry(int index) const { return entries[static_cast<size_t>(index)]; }
+    juce::String getCategory(int index) const;
+
+    // Category tree as flattened folder paths (e.g. "Factory/Rhythmic")
+    const juce::StringArray& getCategories() const noexcept { return categories; }
+
+    // Decodes a single preset state from the mapped payload
+    juce::ValueTree decodeState(int index) const;
+
+    const juce::File& getFile() const noexcept { return file; }
+    juce::String getLastErrorMessage() const { return lastErrorMessage; }
+
+    static constexpr const char* fileExtension = ".tvbank";
+    static constexpr const char* fileWildcard = "*.tvbank";
+
+private:
+    bool parseIndex(const char* data, size_t dataSize);
+    bool fail(const juce::String& message);
+
+    juce::File file;
+    std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+    std::vector<Entry> entries;
+    juce::StringArray categories;
+    juce::String lastErrorMessage;
+
+    // Constants
+    static constexpr juce::uint32 formatVersion = 1;
+    static constexpr size_t headerSize = 32;
+    static constexpr int MAX_BANK_PRESETS = 65536;
+    static constexpr int MAX_STRING_BYTES = 1024;
+    static constexpr juce::uint32 MAX_PRESET_DATA_SIZE = 1024 * 1024; // Matches the XML preset limit
+    static constexpr juce::int64 MAX_BANK_FILE_SIZE = 512 * 1024 * 1024;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetBank)
+};
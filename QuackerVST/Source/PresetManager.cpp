@@ -50,14 +50,28 @@ juce::String PresetManager::Preset::sanitizeCategory(const juce::String& categor
 }
 
 bool PresetManager::Preset::isValid() const noexcept {
-    return name.isNotEmpty() &&
-           category.isNotEmpty() &&
-           state.isValid() &&
-           state.hasType(state.getType());
+    if (name.isEmpty() || category.isEmpty()) {
+        return false;
+    }
+    
+    // Bank-backed presets are validated when the bank index is parsed
+    if (bank != nullptr) {
+        return juce::isPositiveAndBelow(bankIndex, bank->getNumPresets());
+    }
+    
+    return state.isValid() && state.hasType(state.getType());
+}
+
+juce::ValueTree PresetManager::Preset::resolveState() const {
+    if (state.isValid() || bank == nullptr) {
+        return state;
+    }
+    return bank->decodeState(bankIndex);
 }
 
 PresetManager::PresetManager(juce::AudioProcessorValueTreeState& apvts)
-    : apvts(apvts)
+    : apvts(apvts),
+      catalog(std::make_shared<const Catalog>())
 {
     // Set up preset directory with platform-specific handling
     try {
@@ -93,7 +107,12 @@ PresetManager::PresetManager(juce::AudioProcessorValueTreeState& apvts)
 
 PresetManager::~PresetManager()
 {
-    // Cleanup is automatic with smart pointers
+    // The writer is shared and may outlive this instance, so its own shutdown flush
+    // doesn't help a host that quits right after closing the plugin. Give this
+    // instance's queued saves a bounded chance to reach the disk first.
+    if (!presetWriter->waitUntilIdle(SHUTDOWN_FLUSH_TIMEOUT_MS)) {
+        DBG("PresetManager: preset writes still pending at shutdown");
+    }
 }
 
 bool PresetManager::createPresetDirectory()
@@ -141,23 +160,30 @@ bool PresetManager::createPresetDirectory()
 
 void PresetManager::scanForPresets()
 {
-    const juce::ScopedWriteLock lock(presetsLock);
+    // Readers keep using the current snapshot while the scan builds the next one
+    const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(catalogWriteLock);
     
     try {
-        presets.clear();
+        PresetMap scannedPresets;
         
         if (!presetDirectory.exists()) {
+            publishCatalog(std::move(scannedPresets));
             reportError(ErrorCode::DirectoryCreationFailed,
                        "Preset directory does not exist: " + presetDirectory.getFullPathName());
             return;
         }
         
         // Recursively scan the preset directory
-        scanDirectory(presetDirectory, "");
+        scanDirectory(presetDirectory, "", scannedPresets);
         
-        // Rebuild the folder hierarchy
-        buildFolderHierarchy();
+        // Saves still queued on the writer aren't on disk yet, but belong in the catalog
+        for (const auto& pendingWrite : presetWriter->getPendingWrites()) {
+            if (pendingWrite.first.isAChildOf(presetDirectory)) {
+                loadPresetFromXml(*pendingWrite.second, pendingWrite.first, scannedPresets);
+            }
+        }
         
+        publishCatalog(std::move(scannedPresets));
         clearError();
     }
     catch (const std::exception& e) {
@@ -168,15 +194,75 @@ void PresetManager::scanForPresets()
 
 void PresetManager::clearFactoryPresets()
 {
-    const juce::ScopedWriteLock lock(presetsLock);
+    const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(catalogWriteLock);
+    
+    PresetMap updatedPresets = getCatalog()->presets;
+    bool removedAny = false;
     
-    for (auto it = presets.begin(); it != presets.end(); ) {
+    for (auto it = updatedPresets.begin(); it != updatedPresets.end(); ) {
         if (it->second && it->second->category == "Factory") {
-            it = presets.erase(it);
+            it = updatedPresets.erase(it);
+            removedAny = true;
         } else {
             ++it;
         }
     }
+    
+    if (removedAny) {
+        publishCatalog(std::move(updatedPresets));
+    }
+}
+
+void PresetManager::publishCatalog(PresetMap newPresets)
+{
+    auto current = getCatalog();
+    auto next = std::make_shared<Catalog>();
+    next->presets = std::move(newPresets);
+    
+    // Overwriting presets in place or rescanning an unchanged folder keeps the layout
+    auto previousSignature = getCatalogSignature(current->presets);
+    auto signature = getCatalogSignature(next->presets);
+    bool layoutChanged = signature != previousSignature;
+    
+    if (layoutChanged) {
+        buildFolderHierarchy(*next);
+    } else {
+        next->folders = current->folders;
+    }
+    
+    // Readers holding the previous snapshot keep it alive until they're done with it
+    std::atomic_store(&catalog, std::shared_ptr<const Catalog>(std::move(next)));
+    
+    if (layoutChanged) {
+        const RealtimeSafetyChecker::CheckedLock::ScopedLockType indexLock(searchIndexLock);
+        
+        for (const auto& entry : previousSignature) {
+            if (!std::binary_search(signature.begin(), signature.end(), entry,
+                                    [](const auto& a, const auto& b) { return a.first < b.first; })) {
+                searchIndex.removePreset(entry.first);
+            }
+        }
+        
+        // Presets already indexed under the same category are skipped by the index
+        for (const auto& entry : signature) {
+            searchIndex.addPreset(entry.first, entry.second);
+        }
+        
+        catalogChanged();
+    }
+}
+
+std::vector<std::pair<juce::String, juce::String>> PresetManager::getCatalogSignature(const PresetMap& presets)
+{
+    std::vector<std::pair<juce::String, juce::String>> signature;
+    signature.reserve(presets.size());
+    
+    for (const auto& preset : presets) {
+        if (preset.second) {
+            signature.emplace_back(preset.first, preset.second->category);
+        }
+    }
+    return signature;
 }
 
 bool PresetManager::savePreset(const juce::String& name, const juce::String& category)
@@ -193,7 +279,7 @@ bool PresetManager::savePreset(const juce::String& name, const juce::String& cat
     
     try {
         auto currentState = apvts.copyState();
-        auto newPreset = std::make_unique<Preset>(name, category, currentState);
+        std::shared_ptr<const Preset> newPreset = std::make_shared<const Preset>(name, category, currentState);
         
         if (!newPreset->isValid()) {
             reportError(ErrorCode::InvalidPresetData, "Invalid preset data");
@@ -201,54 +287,21 @@ bool PresetManager::savePreset(const juce::String& name, const juce::String& cat
         }
         
         // Determine the target directory
-        juce::File targetDir;
-        
-        if (category == "Factory" || category.startsWith("Factory/")) {
-            if (category == "Factory") {
-                targetDir = presetDirectory.getChildFile("Factory");
-            } else {
-                juce::String subfolderPath = category.substring(8);
-                targetDir = presetDirectory.getChildFile("Factory");
-                
-                juce::StringArray folders = juce::StringArray::fromTokens(subfolderPath, "/", "");
-                for (const auto& folder : folders) {
-                    targetDir = targetDir.getChildFile(folder);
-                    if (!targetDir.exists() && !targetDir.createDirectory()) {
-                        reportError(ErrorCode::DirectoryCreationFailed,
-                                   "Failed to create directory: " + targetDir.getFullPathName());
-                        return false;
-                    }
-                }
-            }
-        } else {
-            targetDir = presetDirectory.getChildFile("User");
-            
-            if (category != "User" && !category.isEmpty()) {
-                juce::StringArray folders = juce::StringArray::fromTokens(category, "/", "");
-                for (const auto& folder : folders) {
-                    targetDir = targetDir.getChildFile(folder);
-                    if (!targetDir.exists() && !targetDir.createDirectory()) {
-                        reportError(ErrorCode::DirectoryCreationFailed,
-                                   "Failed to create directory: " + targetDir.getFullPathName());
-                        return false;
-                    }
-                }
-            }
-        }
-        
-        // Ensure directory exists
-        if (!targetDir.exists() && !targetDir.createDirectory()) {
-            reportError(ErrorCode::DirectoryCreationFailed,
-                       "Failed to create preset directory at: " + targetDir.getFullPathName());
+        juce::File targetDir = getTargetDirectoryForCategory(category);
+        if (targetDir == juce::File()) {
             return false;
         }
         
         // Save preset to file
         juce::File presetFile = targetDir.getChildFile(generateSafeFileName(name));
         
-        if (savePresetToFile(*newPreset, presetFile)) {
-            const juce::ScopedWriteLock lock(presetsLock);
-            presets[name] = std::move(newPreset);
+        if (savePresetToFile(*newPreset, presetFile, newPreset)) {
+            const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(catalogWriteLock);
+            
+            PresetMap updatedPresets = getCatalog()->presets;
+            updatedPresets[name] = std::move(newPreset);
+            publishCatalog(std::move(updatedPresets));
+            
             clearError();
             return true;
         }
@@ -262,19 +315,80 @@ bool PresetManager::savePreset(const juce::String& name, const juce::String& cat
     }
 }
 
+juce::File PresetManager::getTargetDirectoryForCategory(const juce::String& category)
+{
+    juce::File targetDir;
+    
+    if (category == "Factory" || category.startsWith("Factory/")) {
+        if (category == "Factory") {
+            targetDir = presetDirectory.getChildFile("Factory");
+        } else {
+            juce::String subfolderPath = category.substring(8);
+            targetDir = presetDirectory.getChildFile("Factory");
+            
+            juce::StringArray folders = juce::StringArray::fromTokens(subfolderPath, "/", "");
+            for (const auto& folder : folders) {
+                targetDir = targetDir.getChildFile(folder);
+                if (!targetDir.exists() && !targetDir.createDirectory()) {
+                    reportError(ErrorCode::DirectoryCreationFailed,
+                               "Failed to create directory: " + targetDir.getFullPathName());
+                    return {};
+                }
+            }
+        }
+    } else {
+        targetDir = presetDirectory.getChildFile("User");
+        
+        if (category != "User" && !category.isEmpty()) {
+            juce::StringArray folders = juce::StringArray::fromTokens(category, "/", "");
+            for (const auto& folder : folders) {
+                targetDir = targetDir.getChildFile(folder);
+                if (!targetDir.exists() && !targetDir.createDirectory()) {
+                    reportError(ErrorCode::DirectoryCreationFailed,
+                               "Failed to create directory: " + targetDir.getFullPathName());
+                    return {};
+                }
+            }
+        }
+    }
+    
+    // Ensure directory exists
+    if (!targetDir.exists() && !targetDir.createDirectory()) {
+        reportError(ErrorCode::DirectoryCreationFailed,
+                   "Failed to create preset directory at: " + targetDir.getFullPathName());
+        return {};
+    }
+    
+    return targetDir;
+}
+
 bool PresetManager::loadPreset(const juce::String& name)
 {
-    const juce::ScopedReadLock lock(presetsLock);
+    // Holding the preset keeps it alive even if the catalog is replaced meanwhile,
+    // so no lock is held while the state is applied and callbacks run
+    std::shared_ptr<const Preset> preset;
+    {
+        auto snapshot = getCatalog();
+        auto it = snapshot->presets.find(name);
+        if (it != snapshot->presets.end()) {
+            preset = it->second;
+        }
+    }
     
-    auto it = presets.find(name);
-    if (it == presets.end() || !it->second) {
+    if (!preset) {
         reportError(ErrorCode::PresetNotFound, "Preset not found: " + name);
         return false;
     }
     
     try {
-        // Create a deep copy of the preset state
-        juce::ValueTree presetCopy = it->second->state.createCopy();
+        // Create a deep copy of the preset state (decoded on demand for bank presets)
+        juce::ValueTree presetState = preset->resolveState();
+        if (!presetState.isValid()) {
+            reportError(ErrorCode::InvalidPresetData, "Failed to decode preset: " + name);
+            return false;
+        }
+        
+        juce::ValueTree presetCopy = presetState.createCopy();
         
         // Replace the entire state with the preset's state
         apvts.replaceState(presetCopy);
@@ -340,10 +454,10 @@ void PresetManager::initializeDefaultPresets()
 
 juce::StringArray PresetManager::getPresetNames() const
 {
-    const juce::ScopedReadLock lock(presetsLock);
+    auto snapshot = getCatalog();
     
     juce::StringArray names;
-    for (const auto& preset : presets) {
+    for (const auto& preset : snapshot->presets) {
         if (preset.second && preset.second->isValid()) {
             names.add(preset.first);
         }
@@ -351,14 +465,20 @@ juce::StringArray PresetManager::getPresetNames() const
     return names;
 }
 
+juce::StringArray PresetManager::searchPresets(const juce::String& query, int maxResults) const
+{
+    const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(searchIndexLock);
+    return searchIndex.search(query, maxResults);
+}
+
 juce::StringArray PresetManager::getCategories() const
 {
-    const juce::ScopedReadLock lock(presetsLock);
+    auto snapshot = getCatalog();
     
     juce::StringArray categories;
     std::set<juce::String> uniqueCategories;
     
-    for (const auto& preset : presets) {
+    for (const auto& preset : snapshot->presets) {
         if (preset.second && preset.second->isValid()) {
             uniqueCategories.insert(preset.second->category);
         }
@@ -371,7 +491,8 @@ juce::StringArray PresetManager::getCategories() const
     return categories;
 }
 
-bool PresetManager::savePresetToFile(const Preset& preset, const juce::File& presetFile)
+bool PresetManager::savePresetToFile(const Preset& preset, const juce::File& presetFile,
+                                     std::shared_ptr<const Preset> catalogEntry)
 {
     try {
         // Validate the preset
@@ -381,7 +502,7 @@ bool PresetManager::savePresetToFile(const Preset& preset, const juce::File& pre
         }
         
         // Convert state to XML
-        auto xml = getXmlFromState(preset.state);
+        auto xml = getXmlFromState(preset.resolveState());
         if (!xml) {
             reportError(ErrorCode::InvalidPresetData, "Failed to create XML from preset state");
             return false;
@@ -393,18 +514,18 @@ bool PresetManager::savePresetToFile(const Preset& preset, const juce::File& pre
         xml->setAttribute("dateCreated", preset.dateCreated.toISO8601(true));
         xml->setAttribute("version", "1.0"); // Version for future compatibility
         
-        // Save to file with error checking
-        if (!xml->writeTo(presetFile)) {
-            reportError(ErrorCode::FileWriteFailed,
-                       "Failed to write preset file: " + presetFile.getFullPathName());
-            return false;
-        }
+        // The disk write happens on the shared writer thread, replacing any queued
+        // save of the same file, so callers never wait on the file system.
+        // The writer outlives this manager, so the failure callback checks it's still here.
+        juce::WeakReference<PresetManager> weakThis(this);
+        juce::String name = preset.name;
         
-        // Verify the file was written
-        if (!presetFile.exists() || presetFile.getSize() == 0) {
-            reportError(ErrorCode::FileWriteFailed, "Preset file is empty or doesn't exist");
-            return false;
-        }
+        presetWriter->enqueue(presetFile, std::move(xml),
+            [weakThis, name, catalogEntry](const juce::File& file, const juce::String& message) {
+                if (auto* manager = weakThis.get()) {
+                    manager->presetWriteFailed(name, file, catalogEntry, message);
+                }
+            });
         
         clearError();
         return true;
@@ -416,7 +537,47 @@ bool PresetManager::savePresetToFile(const Preset& preset, const juce::File& pre
     }
 }
 
-bool PresetManager::loadPresetFromFile(const juce::File& file)
+void PresetManager::presetWriteFailed(const juce::String& name, const juce::File& presetFile,
+                                      const std::shared_ptr<const Preset>& catalogEntry, const juce::String& message)
+{
+    {
+        const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(catalogWriteLock);
+        
+        // A newer save of the same file is still queued and has its own outcome
+        for (const auto& pendingWrite : presetWriter->getPendingWrites()) {
+            if (pendingWrite.first == presetFile) {
+                return;
+            }
+        }
+        
+        PresetMap updatedPresets = getCatalog()->presets;
+        auto it = updatedPresets.find(name);
+        
+        // Only take back what this save put there. Saves made through savePreset know
+        // their entry; extracted bank presets were picked up by name from the queue.
+        bool isThisSave = it != updatedPresets.end()
+                          && (catalogEntry == nullptr || it->second == catalogEntry);
+        
+        if (isThisSave) {
+            updatedPresets.erase(it);
+            
+            // An older version that's still on disk stays available
+            if (presetFile.existsAsFile()) {
+                loadPresetFromFile(presetFile, updatedPresets);
+            }
+            
+            publishCatalog(std::move(updatedPresets));
+        }
+    }
+    
+    reportError(ErrorCode::FileWriteFailed, "Preset \"" + name + "\" was not saved. " + message);
+    
+    if (onPresetWriteFailed) {
+        onPresetWriteFailed(name, lastErrorMessage);
+    }
+}
+
+bool PresetManager::loadPresetFromFile(const juce::File& file, PresetMap& target)
 {
     if (!validatePresetFile(file)) {
         reportError(ErrorCode::FileReadFailed,
@@ -432,24 +593,36 @@ bool PresetManager::loadPresetFromFile(const juce::File& file)
             return false;
         }
         
+        return loadPresetFromXml(*xml, file, target);
+    }
+    catch (const std::exception& e) {
+        reportError(ErrorCode::FileReadFailed,
+                   "Exception loading preset file: " + juce::String(e.what()));
+        return false;
+    }
+}
+
+bool PresetManager::loadPresetFromXml(const juce::XmlElement& xml, const juce::File& file, PresetMap& target)
+{
+    try {
         // Extract metadata with validation
-        juce::String name = xml->getStringAttribute("name").trim();
+        juce::String name = xml.getStringAttribute("name").trim();
         if (name.isEmpty()) {
             name = file.getFileNameWithoutExtension();
         }
         name = Preset::sanitizeName(name);
         
-        juce::String category = xml->getStringAttribute("category", "").trim();
+        juce::String category = xml.getStringAttribute("category", "").trim();
         if (category.isEmpty()) {
             category = determineCategory(file);
         }
         category = Preset::sanitizeCategory(category);
         
         juce::Time dateCreated = juce::Time::fromISO8601(
-            xml->getStringAttribute("dateCreated", juce::Time::getCurrentTime().toISO8601(true)));
+            xml.getStringAttribute("dateCreated", juce::Time::getCurrentTime().toISO8601(true)));
         
         // Get the state
-        juce::ValueTree state = getStateFromXml(*xml);
+        juce::ValueTree state = getStateFromXml(xml);
         if (!state.isValid()) {
             reportError(ErrorCode::InvalidPresetData,
                        "Invalid state in preset file: " + file.getFullPathName());
@@ -457,10 +630,9 @@ bool PresetManager::loadPresetFromFile(const juce::File& file)
         }
         
         // Create and store the preset
-        auto preset = std::make_unique<Preset>(name, category, state, dateCreated);
+        auto preset = std::make_shared<const Preset>(name, category, state, dateCreated);
         if (preset->isValid()) {
-            const juce::ScopedWriteLock lock(presetsLock);
-            presets[name] = std::move(preset);
+            target[name] = std::move(preset);
             clearError();
             return true;
         } else {
@@ -475,6 +647,161 @@ bool PresetManager::loadPresetFromFile(const juce::File& file)
     }
 }
 
+bool PresetManager::loadPresetBank(const juce::File& bankFile)
+{
+    auto bank = openPresetBank(bankFile);
+    if (bank == nullptr) {
+        return false;
+    }
+    
+    const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(catalogWriteLock);
+    
+    PresetMap updatedPresets = getCatalog()->presets;
+    addPresetsFromBank(bank, updatedPresets);
+    publishCatalog(std::move(updatedPresets));
+    
+    clearError();
+    return true;
+}
+
+std::shared_ptr<const PresetBank> PresetManager::openPresetBank(const juce::File& bankFile)
+{
+    if (!validateBankFile(bankFile)) {
+        reportError(ErrorCode::InvalidBankFile,
+                   "Invalid preset bank: " + bankFile.getFullPathName());
+        return nullptr;
+    }
+    
+    auto bank = std::make_shared<PresetBank>();
+    if (!bank->open(bankFile)) {
+        reportError(ErrorCode::InvalidBankFile, bank->getLastErrorMessage());
+        return nullptr;
+    }
+    
+    return bank;
+}
+
+void PresetManager::addPresetsFromBank(const std::shared_ptr<const PresetBank>& bank, PresetMap& target)
+{
+    // Only the index is touched here - preset states stay in the mapped file
+    for (int i = 0; i < bank->getNumPresets(); ++i) {
+        const auto& entry = bank->getEntry(i);
+        auto preset = std::make_shared<const Preset>(entry.name, bank->getCategory(i), bank, i, entry.dateCreated);
+        
+        if (!preset->isValid()) {
+            continue;
+        }
+        
+        // A preset file of the same name wins, so importing a bank never hides the user's own
+        auto existing = target.find(preset->name);
+        if (existing != target.end() && existing->second && existing->second->bank == nullptr) {
+            continue;
+        }
+        
+        target[preset->name] = std::move(preset);
+    }
+}
+
+bool PresetManager::importPresetBank(const juce::File& bankFile)
+{
+    if (!validateBankFile(bankFile)) {
+        reportError(ErrorCode::InvalidBankFile,
+                   "Invalid preset bank: " + bankFile.getFullPathName());
+        return false;
+    }
+    
+    // Copy the bank next to the user presets so it's picked up by future scans
+    juce::File targetFile = presetDirectory.getChildFile(bankFile.getFileName());
+    
+    if (targetFile != bankFile && !bankFile.copyFileTo(targetFile)) {
+        reportError(ErrorCode::FileWriteFailed,
+                   "Failed to copy preset bank to: " + targetFile.getFullPathName());
+        return false;
+    }
+    
+    return loadPresetBank(targetFile);
+}
+
+bool PresetManager::exportPresetBank(const juce::File& bankFile, const juce::String& categoryPrefix)
+{
+    std::vector<PresetBank::Source> sources;
+    
+    {
+        auto snapshot = getCatalog();
+        sources.reserve(snapshot->presets.size());
+        
+        for (const auto& preset : snapshot->presets) {
+            if (!preset.second || !preset.second->isValid()) {
+                continue;
+            }
+            
+            if (categoryPrefix.isNotEmpty() && !preset.second->category.startsWith(categoryPrefix)) {
+                continue;
+            }
+            
+            sources.push_back({ preset.second->name, preset.second->category,
+                                preset.second->resolveState(), preset.second->dateCreated });
+        }
+    }
+    
+    if (sources.empty()) {
+        reportError(ErrorCode::PresetNotFound, "No presets to export");
+        return false;
+    }
+    
+    juce::String errorMessage;
+    if (!PresetBank::write(bankFile.withFileExtension(PresetBank::fileExtension), sources, errorMessage)) {
+        reportError(ErrorCode::FileWriteFailed, errorMessage);
+        return false;
+    }
+    
+    clearError();
+    return true;
+}
+
+bool PresetManager::extractPresetBank(const juce::File& bankFile)
+{
+    PresetBank bank;
+    if (!bank.open(bankFile)) {
+        reportError(ErrorCode::InvalidBankFile, bank.getLastErrorMessage());
+        return false;
+    }
+    
+    // Write every bank preset back out into the regular folder layout
+    bool allWritten = true;
+    
+    for (int i = 0; i < bank.getNumPresets(); ++i) {
+        const auto& entry = bank.getEntry(i);
+        Preset preset(entry.name, bank.getCategory(i), bank.decodeState(i), entry.dateCreated);
+        
+        if (!preset.isValid()) {
+            allWritten = false;
+            continue;
+        }
+        
+        juce::File targetDir = getTargetDirectoryForCategory(preset.category);
+        if (targetDir == juce::File()) {
+            allWritten = false;
+            continue;
+        }
+        
+        // Leave an existing preset file alone rather than overwrite it with the bank's copy
+        juce::File targetFile = targetDir.getChildFile(generateSafeFileName(preset.name));
+        if (!targetFile.existsAsFile() && !savePresetToFile(preset, targetFile)) {
+            allWritten = false;
+        }
+    }
+    
+    scanForPresets();
+    
+    if (!allWritten) {
+        reportError(ErrorCode::FileWriteFailed,
+                   "Some presets could not be extracted from: " + bankFile.getFullPathName());
+    }
+    
+    return allWritten;
+}
+
 juce::String PresetManager::generateSafeFileName(const juce::String& name)
 {
     // Sanitize the name for file system
@@ -529,10 +856,10 @@ std::unique_ptr<juce::XmlElement> PresetManager::getXmlFromState(const juce::Val
 
 juce::StringArray PresetManager::getFactoryPresetNames() const
 {
-    const juce::ScopedReadLock lock(presetsLock);
+    auto snapshot = getCatalog();
     
     juce::StringArray names;
-    for (const auto& presetPair : presets) {
+    for (const auto& presetPair : snapshot->presets) {
         if (presetPair.second &&
             presetPair.second->isValid() &&
             presetPair.second->category.startsWith("Factory")) {
@@ -544,10 +871,10 @@ juce::StringArray PresetManager::getFactoryPresetNames() const
 
 juce::StringArray PresetManager::getUserPresetNames() const
 {
-    const juce::ScopedReadLock lock(presetsLock);
+    auto snapshot = getCatalog();
     
     juce::StringArray names;
-    for (const auto& presetPair : presets) {
+    for (const auto& presetPair : snapshot->presets) {
         if (presetPair.second &&
             presetPair.second->isValid() &&
             !presetPair.second->category.startsWith("Factory")) {
@@ -559,10 +886,10 @@ juce::StringArray PresetManager::getUserPresetNames() const
 
 juce::String PresetManager::getPresetCategory(const juce::String& presetName) const
 {
-    const juce::ScopedReadLock lock(presetsLock);
+    auto snapshot = getCatalog();
     
-    auto it = presets.find(presetName);
-    if (it != presets.end() && it->second) {
+    auto it = snapshot->presets.find(presetName);
+    if (it != snapshot->presets.end() && it->second) {
         return it->second->category;
     }
     return "User"; // Default to User category if not found
@@ -627,8 +954,10 @@ std::vector<juce::String> PresetManager::splitFolderPath(const juce::String& pat
     return components;
 }
 
-void PresetManager::buildFolderHierarchy()
+void PresetManager::buildFolderHierarchy(Catalog& target)
 {
+    auto& presetFolders = target.folders;
+    
     // Clear existing hierarchy
     presetFolders.clear();
     
@@ -637,7 +966,7 @@ void PresetManager::buildFolderHierarchy()
     presetFolders["User"] = PresetFolder{"User", {}, {}};
     
     // Process all presets
-    for (const auto& preset : presets) {
+    for (const auto& preset : target.presets) {
         if (!preset.second || !preset.second->isValid()) {
             continue;
         }
@@ -679,10 +1008,11 @@ void PresetManager::buildFolderHierarchy()
 
 juce::StringArray PresetManager::getFactoryCategories() const
 {
+    auto snapshot = getCatalog();
     juce::StringArray categories;
     
-    auto it = presetFolders.find("Factory");
-    if (it != presetFolders.end()) {
+    auto it = snapshot->folders.find("Factory");
+    if (it != snapshot->folders.end()) {
         categories.add("Factory");
         
         std::function<void(const PresetFolder&, const juce::String&)> traverseFolder =
@@ -703,11 +1033,12 @@ juce::StringArray PresetManager::getFactoryCategories() const
 
 juce::StringArray PresetManager::getPresetsInFolder(const juce::String& folderPath) const
 {
+    auto snapshot = getCatalog();
     juce::StringArray result;
     
     if (folderPath == "Factory" || folderPath == "User") {
-        auto it = presetFolders.find(folderPath);
-        if (it != presetFolders.end()) {
+        auto it = snapshot->folders.find(folderPath);
+        if (it != snapshot->folders.end()) {
             for (const auto& presetName : it->second.presets) {
                 result.add(presetName);
             }
@@ -715,7 +1046,7 @@ juce::StringArray PresetManager::getPresetsInFolder(const juce::String& folderPa
         return result;
     }
     
-    const PresetFolder* folder = getFolderByPath(folderPath);
+    const PresetFolder* folder = getFolderByPath(*snapshot, folderPath);
     if (folder != nullptr) {
         for (const auto& presetName : folder->presets) {
             result.add(presetName);
@@ -730,7 +1061,7 @@ juce::String PresetManager::categoryToFolderPath(const juce::String& category) c
     return category;
 }
 
-const PresetManager::PresetFolder* PresetManager::getFolderByPath(const juce::String& path) const
+const PresetManager::PresetFolder* PresetManager::getFolderByPath(const Catalog& source, const juce::String& path)
 {
     auto components = splitFolderPath(path);
     
@@ -738,8 +1069,8 @@ const PresetManager::PresetFolder* PresetManager::getFolderByPath(const juce::St
         return nullptr;
     }
     
-    auto rootFolderIt = presetFolders.find(components[0]);
-    if (rootFolderIt == presetFolders.end()) {
+    auto rootFolderIt = source.folders.find(components[0]);
+    if (rootFolderIt == source.folders.end()) {
         return nullptr;
     }
     
@@ -756,7 +1087,7 @@ const PresetManager::PresetFolder* PresetManager::getFolderByPath(const juce::St
     return currentFolder;
 }
 
-void PresetManager::scanDirectory(const juce::File& directory, const juce::String& categoryPrefix)
+void PresetManager::scanDirectory(const juce::File& directory, const juce::String& categoryPrefix, PresetMap& target)
 {
     if (!directory.exists() || !directory.isDirectory()) {
         return;
@@ -766,7 +1097,16 @@ void PresetManager::scanDirectory(const juce::File& directory, const juce::Strin
         // Process all XML files in this directory
         for (const auto& file : directory.findChildFiles(juce::File::findFiles, false, "*.xml")) {
             if (validatePresetFile(file)) {
-                loadPresetFromFile(file);
+                loadPresetFromFile(file, target);
+            }
+        }
+        
+        // Preset banks carry their own categories, so their location doesn't matter
+        for (const auto& file : directory.findChildFiles(juce::File::findFiles, false, PresetBank::fileWildcard)) {
+            if (validateBankFile(file)) {
+                if (auto bank = openPresetBank(file)) {
+                    addPresetsFromBank(bank, target);
+                }
             }
         }
         
@@ -784,7 +1124,7 @@ void PresetManager::scanDirectory(const juce::File& directory, const juce::Strin
                 category = subdir.getFileName();
             }
             
-            scanDirectory(subdir, category);
+            scanDirectory(subdir, category, target);
         }
     }
     catch (const std::exception& e) {
@@ -863,6 +1203,19 @@ bool PresetManager::validatePresetFile(const juce::File& file) const noexcept
     return true;
 }
 
+bool PresetManager::validateBankFile(const juce::File& file) const noexcept
+{
+    if (!file.existsAsFile() || !file.hasFileExtension(PresetBank::fileExtension)) {
+        return false;
+    }
+    
+    if (file.getSize() > MAX_PRESET_BANK_FILE_SIZE || file.getSize() == 0) {
+        return false;
+    }
+    
+    return file.hasReadAccess();
+}
+
 void PresetManager::reportError(ErrorCode code, const juce::String& message) const noexcept
 {
     lastError = code;
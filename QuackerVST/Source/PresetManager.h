@@ -9,6 +9,10 @@
 */
 #pragma once
 #include <JuceHeader.h>
+#include "PresetBank.h"
+#include "PresetSearchIndex.h"
+#include "PresetWriter.h"
+#include "RealtimeSafetyChecker.h"
 
 class PresetManager
 {
@@ -23,7 +27,8 @@ public:
         PresetNotFound,
         InvalidPresetName,
         InvalidCategory,
-        ParameterError
+        ParameterError,
+        InvalidBankFile
     };
     
     PresetManager(juce::AudioProcessorValueTreeState& apvts);
@@ -36,6 +41,11 @@ public:
         juce::ValueTree state;
         juce::Time dateCreated;
         
+        // Presets loaded from a bank keep their state in the mapped bank file
+        // and are only decoded when needed
+        std::shared_ptr<const PresetBank> bank;
+        int bankIndex = -1;
+        
         // Constructor with validation
         Preset(const juce::String& n, const juce::String& cat,
                const juce::ValueTree& s, juce::Time date = juce::Time::getCurrentTime())
@@ -44,6 +54,18 @@ public:
               state(s),
               dateCreated(date) {}
         
+        // Bank-backed constructor
+        Preset(const juce::String& n, const juce::String& cat,
+               std::shared_ptr<const PresetBank> sourceBank, int index, juce::Time date)
+            : name(sanitizeName(n)),
+              category(sanitizeCategory(cat)),
+              dateCreated(date),
+              bank(std::move(sourceBank)),
+              bankIndex(index) {}
+        
+        // Returns the preset state, decoding it from the bank if necessary
+        juce::ValueTree resolveState() const;
+        
         // Validation helpers
         static juce::String sanitizeName(const juce::String& name);
         static juce::String sanitizeCategory(const juce::String& category);
@@ -62,11 +84,25 @@ public:
     juce::StringArray getPresetNames() const;
     juce::StringArray getCategories() const;
     
+    // Preset names matching every term of the query in their name or category, best matches first
+    juce::StringArray searchPresets(const juce::String& query, int maxResults = 50) const;
+    
     const juce::File& getCurrentPresetDirectory() const { return presetDirectory; }
     
+    // Incremented whenever the set of presets or their categories changes,
+    // so views can cache anything derived from the catalog
+    juce::uint32 getCatalogVersion() const noexcept { return catalogVersion.load(); }
+    
     void scanForPresets();
     void clearFactoryPresets();
     
+    // Preset banks (single-file preset collections). A bank preset never replaces
+    // a preset file of the same name; extracting writes only the missing files.
+    bool loadPresetBank(const juce::File& bankFile);
+    bool importPresetBank(const juce::File& bankFile);
+    bool exportPresetBank(const juce::File& bankFile, const juce::String& categoryPrefix = {});
+    bool extractPresetBank(const juce::File& bankFile);
+    
     // State management helpers
     juce::ValueTree getStateFromXml(const juce::XmlElement& xml);
     std::unique_ptr<juce::XmlElement> getXmlFromState(const juce::ValueTree& state);
@@ -86,6 +122,11 @@ public:
     using PresetLoadedCallback = std::function<void()>;
     void setPresetLoadedCallback(PresetLoadedCallback callback) { onPresetLoaded = callback; }
     
+    // Called on the message thread when a save's background write fails, after the
+    // preset has been taken back out of the catalog
+    using PresetWriteFailedCallback = std::function<void(const juce::String& presetName, const juce::String& message)>;
+    void setPresetWriteFailedCallback(PresetWriteFailedCallback callback) { onPresetWriteFailed = callback; }
+    
     // Folder hierarchy representation
     struct PresetFolder {
         juce::String name;
@@ -110,12 +151,6 @@ public:
         }
     };
 
-    // Root folders (Factory, User, etc.)
-    std::map<juce::String, PresetFolder> presetFolders;
-
-    // Build the folder hierarchy from the preset categories
-    void buildFolderHierarchy();
-
     // Get all factory preset categories
     juce::StringArray getFactoryCategories() const;
 
@@ -128,18 +163,44 @@ public:
     // Convert category to folder path
     juce::String categoryToFolderPath(const juce::String& category) const;
 
-    // Helper function to get a subfolder by path
-    const PresetFolder* getFolderByPath(const juce::String& path) const;
-    
     void setCustomPresetName(const juce::String& name);
     
 private:
     juce::AudioProcessorValueTreeState& apvts;
     juce::File presetDirectory;
-    std::map<juce::String, std::unique_ptr<Preset>> presets;
     
-    // Thread safety
-    mutable juce::ReadWriteLock presetsLock;
+    using PresetMap = std::map<juce::String, std::shared_ptr<const Preset>>;
+    
+    // Immutable snapshot of the catalog. Readers grab the current one with
+    // getCatalog() and never block; writers copy it, apply their change and
+    // publish the result with an atomic pointer swap.
+    struct Catalog {
+        PresetMap presets;
+        std::map<juce::String, PresetFolder> folders;   // Root folders (Factory, User)
+    };
+    
+    std::shared_ptr<const Catalog> getCatalog() const noexcept { return std::atomic_load(&catalog); }
+    void publishCatalog(PresetMap newPresets);
+    
+    std::shared_ptr<const Catalog> catalog;
+    RealtimeSafetyChecker::CheckedLock catalogWriteLock{ "catalogWriteLock" };  // Serializes writers only
+    std::atomic<juce::uint32> catalogVersion{0};
+    
+    void catalogChanged() noexcept { ++catalogVersion; }
+    static std::vector<std::pair<juce::String, juce::String>> getCatalogSignature(const PresetMap& presets);
+    
+    // Build the folder hierarchy from the preset categories
+    static void buildFolderHierarchy(Catalog& target);
+    
+    // Helper function to get a subfolder by path
+    static const PresetFolder* getFolderByPath(const Catalog& source, const juce::String& path);
+    
+    // Updated whenever a catalog with a new layout is published
+    PresetSearchIndex searchIndex;
+    RealtimeSafetyChecker::CheckedLock searchIndexLock{ "searchIndexLock" };
+    
+    // Background file writer shared by all instances
+    juce::SharedResourcePointer<PresetWriter> presetWriter;
     
     // Error handling
     mutable ErrorCode lastError = ErrorCode::None;
@@ -147,10 +208,17 @@ private:
     
     // Private helper methods with error handling
     bool createPresetDirectory();
-    bool loadPresetFromFile(const juce::File& file);
+    bool loadPresetFromFile(const juce::File& file, PresetMap& target);
+    bool loadPresetFromXml(const juce::XmlElement& xml, const juce::File& file, PresetMap& target);
     bool savePresetToFile(const Preset& preset);
-    bool savePresetToFile(const Preset& preset, const juce::File& presetFile);
-    void scanDirectory(const juce::File& directory, const juce::String& categoryPrefix);
+    bool savePresetToFile(const Preset& preset, const juce::File& presetFile,
+                          std::shared_ptr<const Preset> catalogEntry = nullptr);
+    void presetWriteFailed(const juce::String& name, const juce::File& presetFile,
+                           const std::shared_ptr<const Preset>& catalogEntry, const juce::String& message);
+    void scanDirectory(const juce::File& directory, const juce::String& categoryPrefix, PresetMap& target);
+    std::shared_ptr<const PresetBank> openPresetBank(const juce::File& bankFile);
+    void addPresetsFromBank(const std::shared_ptr<const PresetBank>& bank, PresetMap& target);
+    juce::File getTargetDirectoryForCategory(const juce::String& category);
     juce::String determineCategory(const juce::File& file);
     juce::String generateSafeFileName(const juce::String& name);
     
@@ -158,6 +226,7 @@ private:
     bool validatePresetName(const juce::String& name) const noexcept;
     bool validateCategory(const juce::String& category) const noexcept;
     bool validatePresetFile(const juce::File& file) const noexcept;
+    bool validateBankFile(const juce::File& file) const noexcept;
     
     // Error reporting
     void reportError(ErrorCode code, const juce::String& message) const noexcept;
@@ -168,11 +237,15 @@ private:
     juce::ValueTree cleanPresetState;
     
     PresetLoadedCallback onPresetLoaded;
+    PresetWriteFailedCallback onPresetWriteFailed;
     
     // Constants
     static constexpr size_t MAX_PRESET_NAME_LENGTH = 128;
     static constexpr size_t MAX_CATEGORY_LENGTH = 256;
     static constexpr juce::int64 MAX_PRESET_FILE_SIZE = 1024 * 1024; // 1MB limit
+    static constexpr juce::int64 MAX_PRESET_BANK_FILE_SIZE = 512 * 1024 * 1024; // 512MB limit
+    static constexpr int SHUTDOWN_FLUSH_TIMEOUT_MS = 2000;
     
+    JUCE_DECLARE_WEAK_REFERENCEABLE(PresetManager)
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetManager)
 };
@@ -0,0 +1,190 @@
+/*
+  ==============================================================================
+
+    PresetMenuModel.cpp
+    Created: 18 Oct 2026 2:05:17pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "PresetMenuModel.h"
+
+PresetMenuModel::PresetMenuModel(PresetManager& pm, int firstPresetMenuID)
+    : presetManager(pm), firstMenuID(firstPresetMenuID)
+{
+}
+
+void PresetMenuModel::refresh()
+{
+    auto version = presetManager.getCatalogVersion();
+
+    if (!builtForVersion.has_value() || *builtForVersion != version)
+    {
+        rebuild();
+        builtForVersion = version;
+    }
+}
+
+void PresetMenuModel::rebuild()
+{
+    orderedPresets.clear();
+    indexByName.clear();
+    sections.clear();
+    presetMenu.reset();
+    presetMenuTickedIndex = -1;
+
+    // Factory root presets, with Default and Classic Tremolo first
+    juce::StringArray rootFactoryPresets = presetManager.getPresetsInFolder("Factory");
+    juce::StringArray factoryRoot;
+
+    const juce::StringArray priorityPresets = {"Default", "Classic Tremolo"};
+    for (const auto& priorityPreset : priorityPresets)
+    {
+        int index = rootFactoryPresets.indexOf(priorityPreset);
+        if (index >= 0)
+        {
+            factoryRoot.add(priorityPreset);
+            rootFactoryPresets.remove(index);
+        }
+    }
+    factoryRoot.addArray(rootFactoryPresets);
+    addSection("Factory", factoryRoot, false);
+
+    // Factory subcategories as submenus
+    for (const auto& category : presetManager.getFactoryCategories())
+    {
+        if (category == "Factory")
+            continue;
+
+        juce::String folderName = category.fromLastOccurrenceOf("/", false, false);
+        if (folderName.isEmpty())
+            folderName = category;
+
+        addSection(folderName, presetManager.getPresetsInFolder(category), true);
+    }
+
+    // User presets
+    userSectionIndex = sections.size();
+    addSection("User", presetManager.getPresetsInFolder("User"), false);
+}
+
+void PresetMenuModel::addSection(const juce::String& displayName, const juce::StringArray& presetNames, bool isSubmenu)
+{
+    Section section;
+    section.displayName = displayName;
+    section.firstIndex = static_cast<int>(orderedPresets.size());
+    section.isSubmenu = isSubmenu;
+
+    for (const auto& name : presetNames)
+    {
+        // A preset lives in exactly one folder, so the first occurrence wins
+        if (indexByName.emplace(name, static_cast<int>(orderedPresets.size())).second)
+            orderedPresets.push_back(name);
+    }
+
+    section.numPresets = static_cast<int>(orderedPresets.size()) - section.firstIndex;
+    sections.push_back(std::move(section));
+}
+
+juce::String PresetMenuModel::getPresetName(int index) const
+{
+    if (juce::isPositiveAndBelow(index, getNumPresets()))
+        return orderedPresets[static_cast<size_t>(index)];
+    return {};
+}
+
+int PresetMenuModel::indexOf(const juce::String& presetName) const
+{
+    auto it = indexByName.find(presetName);
+    return it != indexByName.end() ? it->second : -1;
+}
+
+int PresetMenuModel::getAdjacentIndex(const juce::String& currentPreset, bool goForward) const
+{
+    const int numPresets = getNumPresets();
+    if (numPresets == 0)
+        return -1;
+
+    int currentIndex = juce::jmax(0, indexOf(currentPreset));
+
+    if (goForward)
+        return (currentIndex + 1) % numPresets;
+
+    return (currentIndex - 1 + numPresets) % numPresets;
+}
+
+juce::String PresetMenuModel::getPresetForMenuID(int menuID) const
+{
+    return getPresetName(menuID - firstMenuID);
+}
+
+int PresetMenuModel::getTickForSection(const Section& section, int currentIndex) const noexcept
+{
+    return section.containsIndex(currentIndex) ? currentIndex : -1;
+}
+
+void PresetMenuModel::addSectionItems(juce::PopupMenu& menu, const Section& section, int currentIndex) const
+{
+    for (int i = section.firstIndex; i < section.firstIndex + section.numPresets; ++i)
+        menu.addItem(menuIDForIndex(i), orderedPresets[static_cast<size_t>(i)], true, i == currentIndex);
+}
+
+const juce::PopupMenu& PresetMenuModel::getSectionMenu(Section& section, int currentIndex)
+{
+    int tick = getTickForSection(section, currentIndex);
+
+    // Only sections whose ticked item changed need rebuilding
+    if (section.menu == nullptr || section.tickedIndex != tick)
+    {
+        section.menu = std::make_unique<juce::PopupMenu>();
+        addSectionItems(*section.menu, section, currentIndex);
+        section.tickedIndex = tick;
+    }
+
+    return *section.menu;
+}
+
+void PresetMenuModel::addUtilityItem(int menuID, const juce::String& text)
+{
+    utilityItems.emplace_back(menuID, text);
+    presetMenu.reset();
+}
+
+juce::PopupMenu& PresetMenuModel::getPresetMenu(const juce::String& currentPreset)
+{
+    refresh();
+
+    int currentIndex = indexOf(currentPreset);
+
+    if (presetMenu != nullptr && presetMenuTickedIndex == currentIndex)
+        return *presetMenu;
+
+    presetMenu = std::make_unique<juce::PopupMenu>();
+    presetMenuTickedIndex = currentIndex;
+
+    presetMenu->addSectionHeader("Factory Presets");
+
+    for (size_t i = 0; i < sections.size(); ++i)
+    {
+        auto& section = sections[i];
+
+        if (i == userSectionIndex)
+            presetMenu->addSectionHeader("User Presets");
+
+        if (section.isSubmenu)
+            presetMenu->addSubMenu(section.displayName, getSectionMenu(section, currentIndex));
+        else
+            addSectionItems(*presetMenu, section, currentIndex);
+    }
+
+    if (!utilityItems.empty())
+    {
+        presetMenu->addSectionHeader("Utility");
+
+        for (const auto& item : utilityItems)
+            presetMenu->addItem(item.first, item.second);
+    }
+
+    return *presetMenu;
+}
@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+
+    PresetMenuModel.h
+    Created: 18 Oct 2026 2:05:17pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+#pragma once
+#include <JuceHeader.h>
+#include "PresetManager.h"
+
+/**
+ * Cached view of the preset catalog used by the preset browser.
+ *
+ * Holds the presets in menu order with a name lookup, so stepping to the
+ * previous/next preset and mapping menu results back to names are O(1).
+ * Everything is rebuilt only when PresetManager reports a new catalog
+ * version. Popup menus are built per section the first time they're needed
+ * and reused until the catalog or the ticked preset in that section changes.
+ */
+class PresetMenuModel
+{
+public:
+    PresetMenuModel(PresetManager& pm, int firstPresetMenuID);
+    ~PresetMenuModel() = default;
+
+    // Rebuilds the model if the catalog changed since the last call
+    void refresh();
+    void invalidate() noexcept { builtForVersion.reset(); }
+
+    int getNumPresets() const noexcept { return static_cast<int>(orderedPresets.size()); }
+    juce::String getPresetName(int index) const;
+    int indexOf(const juce::String& presetName) const;
+    int getAdjacentIndex(const juce::String& currentPreset, bool goForward) const;
+
+    // Menu item IDs map directly onto positions in the ordered list
+    int menuIDForIndex(int index) const noexcept { return firstMenuID + index; }
+    juce::String getPresetForMenuID(int menuID) const;
+
+    // Fixed items listed under a Utility header at the end of the root menu
+    void addUtilityItem(int menuID, const juce::String& text);
+
+    // The whole root menu with the current preset ticked, cached so it can be shown without a copy
+    juce::PopupMenu& getPresetMenu(const juce::String& currentPreset);
+
+private:
+    // A run of presets in the ordered list that share a menu (root items or a submenu)
+    struct Section {
+        juce::String displayName;
+        int firstIndex = 0;
+        int numPresets = 0;
+        bool isSubmenu = false;
+
+        // Cached menu and the preset index that was ticked when it was built
+        std::unique_ptr<juce::PopupMenu> menu;
+        int tickedIndex = -1;
+
+        bool containsIndex(int index) const noexcept {
+            return index >= firstIndex && index < firstIndex + numPresets;
+        }
+    };
+
+    void rebuild();
+    void addSection(const juce::String& displayName, const juce::StringArray& presetNames, bool isSubmenu);
+    void addSectionItems(juce::PopupMenu& menu, const Section& section, int currentIndex) const;
+    const juce::PopupMenu& getSectionMenu(Section& section, int currentIndex);
+    int getTickForSection(const Section& section, int currentIndex) const noexcept;
+
+    PresetManager& presetManager;
+    const int firstMenuID;
+
+    std::vector<juce::String> orderedPresets;
+    std::unordered_map<juce::String, int> indexByName;
+
+    // Factory root, factory subfolders, then user presets - the same order as the menu
+    std::vector<Section> sections;
+    size_t userSectionIndex = 0;
+
+    std::optional<juce::uint32> builtForVersion;
+
+    std::vector<std::pair<int, juce::String>> utilityItems;
+
+    // Assembled root menu and the preset index it was ticked for
+    std::unique_ptr<juce::PopupMenu> presetMenu;
+    int presetMenuTickedIndex = -1;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetMenuModel)
+};
@@ -0,0 +1,163 @@
+/*
+  ==============================================================================
+
+    PresetSearchComponent.cpp
+    Created: 18 Oct 2026 5:21:36pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "PresetSearchComponent.h"
+
+PresetSearchComponent::PresetSearchComponent(PresetManager& pm, const juce::String& initialQuery)
+    : presetManager(pm)
+{
+    searchBox.setTextToShowWhenEmpty("Search presets...", textColour.withAlpha(0.4f));
+    searchBox.setColour(juce::TextEditor::backgroundColourId, juce::Colours::black.withAlpha(0.6f));
+    searchBox.setColour(juce::TextEditor::textColourId, textColour);
+    searchBox.setColour(juce::TextEditor::outlineColourId, textColour.withAlpha(0.3f));
+    searchBox.setColour(juce::TextEditor::focusedOutlineColourId, highlightColour);
+    searchBox.setColour(juce::CaretComponent::caretColourId, highlightColour);
+    searchBox.setSelectAllWhenFocused(false);
+    searchBox.addKeyListener(this);
+
+    searchBox.onTextChange = [this] { updateResults(); };
+    searchBox.onReturnKey = [this] { choosePreset(juce::jmax(0, resultsList.getSelectedRow())); };
+    searchBox.onEscapeKey = [this] { dismiss(); };
+    addAndMakeVisible(searchBox);
+
+    resultsList.setModel(this);
+    resultsList.setRowHeight(ROW_HEIGHT);
+    resultsList.setColour(juce::ListBox::backgroundColourId, juce::Colours::transparentBlack);
+    resultsList.setWantsKeyboardFocus(false);
+    addAndMakeVisible(resultsList);
+
+    searchBox.setText(initialQuery, false);
+    searchBox.setCaretPosition(initialQuery.length());
+    updateResults();
+
+    setSize(WIDTH, SEARCH_BOX_HEIGHT + ROW_HEIGHT * MAX_VISIBLE_ROWS + 8);
+}
+
+PresetSearchComponent::~PresetSearchComponent()
+{
+    searchBox.removeKeyListener(this);
+    resultsList.setModel(nullptr);
+}
+
+void PresetSearchComponent::paint(juce::Graphics& g)
+{
+    g.fillAll(juce::Colours::black.withAlpha(0.92f));
+}
+
+void PresetSearchComponent::resized()
+{
+    auto bounds = getLocalBounds().reduced(4);
+    searchBox.setBounds(bounds.removeFromTop(SEARCH_BOX_HEIGHT));
+    resultsList.setBounds(bounds);
+}
+
+void PresetSearchComponent::parentHierarchyChanged()
+{
+    // The call-out box is added to the desktop after construction, so focus has to wait
+    juce::Component::SafePointer<PresetSearchComponent> safeThis(this);
+    juce::MessageManager::callAsync([safeThis]
+    {
+        if (safeThis != nullptr && safeThis->isShowing())
+            safeThis->searchBox.grabKeyboardFocus();
+    });
+}
+
+int PresetSearchComponent::getNumRows()
+{
+    return results.size();
+}
+
+void PresetSearchComponent::paintListBoxItem(int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected)
+{
+    if (!juce::isPositiveAndBelow(rowNumber, results.size()))
+        return;
+
+    if (rowIsSelected)
+    {
+        g.setColour(highlightColour.withAlpha(0.2f));
+        g.fillRect(0, 0, width, height);
+    }
+
+    const juce::String& name = results[rowNumber];
+
+    g.setFont(juce::Font(15.0f));
+    g.setColour(rowIsSelected ? highlightColour : textColour);
+    g.drawText(name, 8, 0, width / 2 + 40, height, juce::Justification::centredLeft, true);
+
+    // Category on the right, dimmed
+    g.setFont(juce::Font(12.0f));
+    g.setColour(textColour.withAlpha(0.5f));
+    g.drawText(presetManager.getPresetCategory(name), width / 2 + 52, 0, width / 2 - 60, height,
+               juce::Justification::centredRight, true);
+}
+
+void PresetSearchComponent::listBoxItemClicked(int row, const juce::MouseEvent&)
+{
+    choosePreset(row);
+}
+
+void PresetSearchComponent::returnKeyPressed(int lastRowSelected)
+{
+    choosePreset(lastRowSelected);
+}
+
+bool PresetSearchComponent::keyPressed(const juce::KeyPress& key, juce::Component*)
+{
+    if (results.isEmpty())
+        return false;
+
+    if (key == juce::KeyPress::downKey || key == juce::KeyPress::upKey)
+    {
+        int row = resultsList.getSelectedRow();
+        int delta = key == juce::KeyPress::downKey ? 1 : -1;
+
+        row = row < 0 ? 0 : juce::jlimit(0, results.size() - 1, row + delta);
+        resultsList.selectRow(row);
+        return true;
+    }
+
+    return false;
+}
+
+void PresetSearchComponent::updateResults()
+{
+    auto query = searchBox.getText();
+
+    // An empty query lists everything, which doubles as a flat preset browser
+    results = query.trim().isEmpty() ? presetManager.getPresetNames()
+                                     : presetManager.searchPresets(query, MAX_RESULTS);
+
+    resultsList.updateContent();
+    resultsList.repaint();
+
+    if (results.isEmpty())
+        resultsList.deselectAllRows();
+    else
+        resultsList.selectRow(0);
+}
+
+void PresetSearchComponent::choosePreset(int row)
+{
+    if (!juce::isPositiveAndBelow(row, results.size()))
+        return;
+
+    juce::String presetName = results[row];
+
+    if (onPresetChosen)
+        onPresetChosen(presetName);
+
+    dismiss();
+}
+
+void PresetSearchComponent::dismiss()
+{
+    if (auto* callOutBox = findParentComponentOfClass<juce::CallOutBox>())
+        callOutBox->dismiss();
+}
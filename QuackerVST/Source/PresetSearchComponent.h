@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    PresetSearchComponent.h
+    Created: 18 Oct 2026 5:21:36pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+#pragma once
+#include <JuceHeader.h>
+#include "PresetManager.h"
+
+/**
+ * Type-to-filter preset browser shown in a call-out box.
+ *
+ * Results are refreshed from PresetManager's search index on every keystroke.
+ * Up/down move the selection, Enter or a click loads the selected preset.
+ */
+class PresetSearchComponent : public juce::Component,
+                              private juce::ListBoxModel,
+                              private juce::KeyListener
+{
+public:
+    PresetSearchComponent(PresetManager& pm, const juce::String& initialQuery = {});
+    ~PresetSearchComponent() override;
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    void parentHierarchyChanged() override;
+
+    // Called with the chosen preset name before the search box is dismissed
+    std::function<void(const juce::String&)> onPresetChosen;
+
+private:
+    // ListBoxModel
+    int getNumRows() override;
+    void paintListBoxItem(int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected) override;
+    void listBoxItemClicked(int row, const juce::MouseEvent&) override;
+    void returnKeyPressed(int lastRowSelected) override;
+
+    // KeyListener on the search box, so arrow keys drive the list while typing
+    bool keyPressed(const juce::KeyPress& key, juce::Component* originatingComponent) override;
+
+    void updateResults();
+    void choosePreset(int row);
+    void dismiss();
+
+    PresetManager& presetManager;
+
+    juce::TextEditor searchBox;
+    juce::ListBox resultsList;
+    juce::StringArray results;
+
+    const juce::Colour textColour = juce::Colour(232, 193, 185);
+    const juce::Colour highlightColour = juce::Colour(19, 224, 139);
+
+    static constexpr int MAX_RESULTS = 50;
+    static constexpr int ROW_HEIGHT = 24;
+    static constexpr int SEARCH_BOX_HEIGHT = 28;
+    static constexpr int WIDTH = 250;
+    static constexpr int MAX_VISIBLE_ROWS = 12;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetSearchComponent)
+};
@@ -0,0 +1,241 @@
+/*
+  ==============================================================================
+
+    PresetSearchIndex.cpp
+    Created: 18 Oct 2026 4:47:09pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "PresetSearchIndex.h"
+
+void PresetSearchIndex::clear()
+{
+    documents.clear();
+    documentByName.clear();
+    trigramPostings.clear();
+    wordPrefixes.clear();
+    numRemoved = 0;
+}
+
+void PresetSearchIndex::addPreset(const juce::String& name, const juce::String& category)
+{
+    auto existing = documentByName.find(name);
+    if (existing != documentByName.end()) {
+        // Unchanged presets are the common case during rescans
+        if (documents[static_cast<size_t>(existing->second)].category == category) {
+            return;
+        }
+        removePreset(name);
+    }
+
+    Document document;
+    document.name = name;
+    document.category = category;
+    document.lowerName = name.toLowerCase();
+    document.searchText = (name + " " + category).toLowerCase();
+
+    int documentId = static_cast<int>(documents.size());
+    documents.push_back(std::move(document));
+    documentByName[name] = documentId;
+    indexDocument(documentId);
+}
+
+void PresetSearchIndex::removePreset(const juce::String& name)
+{
+    auto existing = documentByName.find(name);
+    if (existing == documentByName.end()) {
+        return;
+    }
+
+    // Postings are left in place and filtered out at query time until the next compaction
+    documents[static_cast<size_t>(existing->second)].alive = false;
+    documentByName.erase(existing);
+    ++numRemoved;
+
+    if (numRemoved > 64 && numRemoved > static_cast<int>(documents.size()) / 2) {
+        compact();
+    }
+}
+
+juce::StringArray PresetSearchIndex::search(const juce::String& query, int maxResults) const
+{
+    juce::StringArray results;
+    auto terms = getWords(query.trim().toLowerCase());
+
+    if (terms.isEmpty() || maxResults <= 0) {
+        return results;
+    }
+
+    // Intersect the candidate lists of all terms, starting from the first
+    PostingList candidates = findCandidates(terms[0]);
+
+    for (int i = 1; i < terms.size() && !candidates.empty(); ++i) {
+        PostingList termCandidates = findCandidates(terms[i]);
+        PostingList intersection;
+        std::set_intersection(candidates.begin(), candidates.end(),
+                              termCandidates.begin(), termCandidates.end(),
+                              std::back_inserter(intersection));
+        candidates.swap(intersection);
+    }
+
+    struct Match {
+        int tier;
+        const Document* document;
+    };
+    std::vector<Match> matches;
+    matches.reserve(candidates.size());
+
+    for (int documentId : candidates) {
+        const auto& document = documents[static_cast<size_t>(documentId)];
+        if (!document.alive) {
+            continue;
+        }
+
+        // Trigram hits can be false positives - verify every term
+        bool matchesAll = true;
+        for (const auto& term : terms) {
+            if (!document.searchText.contains(term)) {
+                matchesAll = false;
+                break;
+            }
+        }
+
+        if (!matchesAll) {
+            continue;
+        }
+
+        // Name prefix matches first, then name matches, then category-only matches
+        int tier = document.lowerName.startsWith(terms[0]) ? 0
+                 : document.lowerName.contains(terms[0]) ? 1 : 2;
+        matches.push_back({ tier, &document });
+    }
+
+    auto compareMatches = [](const Match& a, const Match& b) {
+        if (a.tier != b.tier) {
+            return a.tier < b.tier;
+        }
+        return a.document->name.compareNatural(b.document->name) < 0;
+    };
+
+    auto numResults = std::min(matches.size(), static_cast<size_t>(maxResults));
+    std::partial_sort(matches.begin(), matches.begin() + static_cast<std::ptrdiff_t>(numResults),
+                      matches.end(), compareMatches);
+
+    results.ensureStorageAllocated(static_cast<int>(numResults));
+    for (size_t i = 0; i < numResults; ++i) {
+        results.add(matches[i].document->name);
+    }
+
+    return results;
+}
+
+std::vector<PresetSearchIndex::Trigram> PresetSearchIndex::getTrigrams(const juce::String& text)
+{
+    std::vector<juce::juce_wchar> characters;
+    characters.reserve(static_cast<size_t>(text.length()));
+
+    for (auto p = text.getCharPointer(); !p.isEmpty(); ) {
+        characters.push_back(p.getAndAdvance());
+    }
+
+    std::vector<Trigram> trigrams;
+    if (characters.size() < 3) {
+        return trigrams;
+    }
+
+    trigrams.reserve(characters.size() - 2);
+    for (size_t i = 0; i + 2 < characters.size(); ++i) {
+        // Unicode code points fit in 21 bits, so three pack losslessly into 64
+        trigrams.push_back((static_cast<Trigram>(characters[i]) << 42)
+                         | (static_cast<Trigram>(characters[i + 1]) << 21)
+                         | static_cast<Trigram>(characters[i + 2]));
+    }
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    return trigrams;
+}
+
+juce::StringArray PresetSearchIndex::getWords(const juce::String& text)
+{
+    auto words = juce::StringArray::fromTokens(text, " \t/_-", "");
+    words.removeEmptyStrings();
+    return words;
+}
+
+void PresetSearchIndex::indexDocument(int documentId)
+{
+    const auto& document = documents[static_cast<size_t>(documentId)];
+
+    // Document IDs only grow, so appending keeps every posting list sorted
+    for (auto trigram : getTrigrams(document.searchText)) {
+        trigramPostings[trigram].push_back(documentId);
+    }
+
+    for (const auto& word : getWords(document.searchText)) {
+        wordPrefixes.emplace(word, documentId);
+    }
+}
+
+PresetSearchIndex::PostingList PresetSearchIndex::findCandidates(const juce::String& term) const
+{
+    PostingList candidates;
+
+    if (term.length() >= 3) {
+        auto trigrams = getTrigrams(term);
+        std::vector<const PostingList*> lists;
+        lists.reserve(trigrams.size());
+
+        for (auto trigram : trigrams) {
+            auto it = trigramPostings.find(trigram);
+            if (it == trigramPostings.end()) {
+                return candidates;
+            }
+            lists.push_back(&it->second);
+        }
+
+        // Start from the rarest trigram so the intersections stay small
+        std::sort(lists.begin(), lists.end(),
+                  [](const PostingList* a, const PostingList* b) { return a->size() < b->size(); });
+
+        candidates = *lists.front();
+        for (size_t i = 1; i < lists.size() && !candidates.empty(); ++i) {
+            PostingList intersection;
+            std::set_intersection(candidates.begin(), candidates.end(),
+                                  lists[i]->begin(), lists[i]->end(),
+                                  std::back_inserter(intersection));
+            candidates.swap(intersection);
+        }
+        return candidates;
+    }
+
+    // Short terms match the start of any word
+    for (auto it = wordPrefixes.lower_bound(term);
+         it != wordPrefixes.end() && it->first.startsWith(term); ++it) {
+        candidates.push_back(it->second);
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    return candidates;
+}
+
+void PresetSearchIndex::compact()
+{
+    std::vector<Document> liveDocuments;
+    liveDocuments.reserve(documentByName.size());
+
+    for (auto& document : documents) {
+        if (document.alive) {
+            liveDocuments.push_back(std::move(document));
+        }
+    }
+
+    clear();
+
+    for (const auto& document : liveDocuments) {
+        addPreset(document.name, document.category);
+    }
+}
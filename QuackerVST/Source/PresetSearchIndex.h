@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    PresetSearchIndex.h
+    Created: 18 Oct 2026 4:47:09pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+/**
+ * Incremental search index over preset names and categories.
+ *
+ * Terms of three or more characters are matched through a trigram index,
+ * shorter terms through a sorted word-prefix map. Candidates are verified
+ * with a substring check, so the index never returns false positives.
+ * Adding a preset that is already indexed with the same category is a
+ * single hash lookup, which keeps rescans cheap.
+ */
+class PresetSearchIndex
+{
+public:
+    PresetSearchIndex() = default;
+    ~PresetSearchIndex() = default;
+
+    void clear();
+    void addPreset(const juce::String& name, const juce::String& category);
+    void removePreset(const juce::String& name);
+
+    // Returns matching preset names, best matches first. Every whitespace
+    // separated term in the query must match the name or the category.
+    juce::StringArray search(const juce::String& query, int maxResults) const;
+
+    int getNumPresets() const noexcept { return static_cast<int>(documentByName.size()); }
+
+private:
+    struct Document {
+        juce::String name;
+        juce::String category;
+        juce::String lowerName;
+        juce::String searchText;    // Lowercase "name category"
+        bool alive = true;
+    };
+
+    using Trigram = juce::uint64;
+    using PostingList = std::vector<int>;
+
+    static std::vector<Trigram> getTrigrams(const juce::String& text);
+    static juce::StringArray getWords(const juce::String& text);
+
+    void indexDocument(int documentId);
+    PostingList findCandidates(const juce::String& term) const;
+    void compact();
+
+    std::vector<Document> documents;
+    std::unordered_map<juce::String, int> documentByName;
+    std::unordered_map<Trigram, PostingList> trigramPostings;
+    std::multimap<juce::String, int> wordPrefixes;
+    int numRemoved = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetSearchIndex)
+};
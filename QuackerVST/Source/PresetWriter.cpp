@@ -0,0 +1,153 @@
+/*
+  ==============================================================================
+
+    PresetWriter.cpp
+    Created: 18 Oct 2026 6:02:48pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "PresetWriter.h"
+
+PresetWriter::PresetWriter()
+    : juce::Thread("Preset Writer")
+{
+    idleEvent.signal();
+    startThread(juce::Thread::Priority::low);
+}
+
+PresetWriter::~PresetWriter()
+{
+    // run() drains the queue once more before returning
+    signalThreadShouldExit();
+    notify();
+    stopThread(SHUTDOWN_TIMEOUT_MS);
+}
+
+void PresetWriter::enqueue(const juce::File& file, std::unique_ptr<juce::XmlElement> xml,
+                           WriteFailedCallback onWriteFailed)
+{
+    if (xml == nullptr) {
+        return;
+    }
+
+    {
+        const juce::ScopedLock lock(queueLock);
+
+        // A newer save of the same file simply replaces the queued contents
+        pendingWrites[file.getFullPathName()] = { file, std::shared_ptr<const juce::XmlElement>(std::move(xml)),
+                                                  std::move(onWriteFailed) };
+        idleEvent.reset();
+    }
+
+    notify();
+}
+
+std::vector<std::pair<juce::File, std::shared_ptr<const juce::XmlElement>>> PresetWriter::getPendingWrites() const
+{
+    const juce::ScopedLock lock(queueLock);
+
+    std::vector<std::pair<juce::File, std::shared_ptr<const juce::XmlElement>>> writes;
+    writes.reserve(pendingWrites.size() + 1);
+
+    // The file being written right now isn't on disk yet either
+    if (currentWrite.xml != nullptr && pendingWrites.count(currentWrite.file.getFullPathName()) == 0) {
+        writes.emplace_back(currentWrite.file, currentWrite.xml);
+    }
+
+    for (const auto& pending : pendingWrites) {
+        writes.emplace_back(pending.second.file, pending.second.xml);
+    }
+
+    return writes;
+}
+
+bool PresetWriter::waitUntilIdle(int timeoutMs)
+{
+    return idleEvent.wait(timeoutMs);
+}
+
+void PresetWriter::run()
+{
+    while (!threadShouldExit()) {
+        writePendingFiles();
+        wait(-1);
+    }
+
+    // Flush anything queued while shutting down
+    writePendingFiles();
+}
+
+void PresetWriter::writePendingFiles()
+{
+    for (;;) {
+        {
+            const juce::ScopedLock lock(queueLock);
+            currentWrite = {};
+
+            if (pendingWrites.empty()) {
+                idleEvent.signal();
+                return;
+            }
+
+            auto next = pendingWrites.begin();
+            currentWrite = std::move(next->second);
+            pendingWrites.erase(next);
+        }
+
+        // currentWrite is only replaced by this thread, so it's safe to read unlocked
+        juce::String errorMessage;
+        if (!writeAtomically(currentWrite.file, *currentWrite.xml, errorMessage)) {
+            #if JUCE_DEBUG
+            DBG("PresetWriter Error: " + errorMessage);
+            #endif
+
+            // The save already returned, so the owner hears about it afterwards, on its own thread
+            if (auto onWriteFailed = currentWrite.onWriteFailed) {
+                juce::MessageManager::callAsync([onWriteFailed, file = currentWrite.file, errorMessage]
+                {
+                    onWriteFailed(file, errorMessage);
+                });
+            }
+        }
+    }
+}
+
+bool PresetWriter::writeAtomically(const juce::File& file, const juce::XmlElement& xml, juce::String& errorMessage)
+{
+    try {
+        // Hidden .tmp sibling, so a directory scan never picks up a partial preset
+        auto temporaryFile = file.getSiblingFile("." + file.getFileName() + ".tmp").getNonexistentSibling(false);
+        juce::TemporaryFile temporary(file, temporaryFile);
+
+        {
+            juce::FileOutputStream out(temporaryFile);
+            if (!out.openedOk()) {
+                errorMessage = "Failed to open preset file for writing: " + temporaryFile.getFullPathName();
+                return false;
+            }
+
+            xml.writeTo(out);
+
+            // FileOutputStream::flush() syncs to disk, so the rename never exposes an incomplete file
+            out.flush();
+
+            if (out.getStatus().failed()) {
+                errorMessage = "Failed to write preset file: " + out.getStatus().getErrorMessage();
+                return false;
+            }
+        }
+
+        if (!temporary.overwriteTargetFileWithTemporary()) {
+            errorMessage = "Failed to replace preset file: " + file.getFullPathName();
+            return false;
+        }
+
+        return true;
+    }
+    catch (const std::exception& e) {
+        errorMessage = "Exception writing preset file: " + juce::String(e.what());
+        return false;
+    }
+}
@@ -0,0 +1,66 @@
+/*
+  ==============================================================================
+
+    PresetWriter.h
+    Created: 18 Oct 2026 6:02:48pm
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+#pragma once
+#include <JuceHeader.h>
+
+/**
+ * Background writer for preset files, shared by every plugin instance
+ * through juce::SharedResourcePointer.
+ *
+ * Each file is written to a temporary sibling, flushed to disk and then
+ * renamed over the target, so a crash never leaves a half-written preset.
+ * Queuing a file that's still waiting to be written replaces the pending
+ * contents, so repeated saves of the same preset cost one disk write.
+ * Anything still queued is written out before the writer is destroyed.
+ * A write that fails calls its failure callback on the message thread.
+ */
+class PresetWriter : private juce::Thread
+{
+public:
+    // Called on the message thread with the file and the reason its write failed
+    using WriteFailedCallback = std::function<void(const juce::File&, const juce::String&)>;
+
+    PresetWriter();
+    ~PresetWriter() override;
+
+    // Queues the XML to be written to the file, replacing any pending write for it
+    void enqueue(const juce::File& file, std::unique_ptr<juce::XmlElement> xml,
+                 WriteFailedCallback onWriteFailed = {});
+
+    // Files that have been queued but not yet written, with their contents
+    std::vector<std::pair<juce::File, std::shared_ptr<const juce::XmlElement>>> getPendingWrites() const;
+
+    // Blocks until every queued file has been written, or the timeout expires; false on timeout.
+    // Owners call it before they go away, since the shared writer may outlive them.
+    bool waitUntilIdle(int timeoutMs);
+
+    // Writes the XML to a temporary file, syncs it and renames it over the target
+    static bool writeAtomically(const juce::File& file, const juce::XmlElement& xml, juce::String& errorMessage);
+
+private:
+    struct PendingWrite {
+        juce::File file;
+        std::shared_ptr<const juce::XmlElement> xml;
+        WriteFailedCallback onWriteFailed;
+    };
+
+    void run() override;
+    void writePendingFiles();
+
+    mutable juce::CriticalSection queueLock;
+    std::map<juce::String, PendingWrite> pendingWrites;    // Keyed by full path
+    PendingWrite currentWrite;                             // File being written, if any
+
+    juce::WaitableEvent idleEvent{ true };
+
+    static constexpr int SHUTDOWN_TIMEOUT_MS = 10000;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetWriter)
+};
@@ -10,6 +10,42 @@
 
 #include "Presets.h"
 
+namespace {
+    // One character per step: 'x' full, 'o' half, '-' closed
+    StepSequencer::Pattern makeGatePattern(const char* steps, float slew) {
+        StepSequencer::Pattern pattern;
+        pattern.numSteps = juce::jlimit(StepSequencer::MIN_STEPS, StepSequencer::MAX_STEPS,
+                                        static_cast<int>(std::strlen(steps)));
+        
+        for (int step = 0; step < pattern.numSteps; ++step) {
+            pattern.levels[step] = steps[step] == 'x' ? 1.0f : (steps[step] == 'o' ? 0.5f : 0.0f);
+            pattern.slews[step] = slew;
+        }
+        
+        return pattern;
+    }
+    
+    void savePatternPreset(QuackerVSTAudioProcessor& processor, const juce::String& name,
+                           const char* steps, float slew, int stepDivision, float depth, float mix) {
+        auto& apvts = processor.apvts;
+        
+        processor.setStepPattern(makeGatePattern(steps, slew));
+        
+        if (auto* modeParam = apvts.getParameter("lfoMode"))
+            modeParam->setValueNotifyingHost(modeParam->convertTo0to1(5)); // Pattern
+        if (auto* stepDivisionParam = apvts.getParameter("seqStepDivision"))
+            stepDivisionParam->setValueNotifyingHost(stepDivisionParam->convertTo0to1(static_cast<float>(stepDivision)));
+        if (auto* depthParam = apvts.getParameter("lfoDepth"))
+            depthParam->setValueNotifyingHost(depth);
+        if (auto* mixParam = apvts.getParameter("mix"))
+            mixParam->setValueNotifyingHost(mix);
+        if (auto* waveshapeEnabledParam = apvts.getParameter("waveshapeEnabled"))
+            waveshapeEnabledParam->setValueNotifyingHost(false);
+        
+        processor.getPresetManager().savePreset(name, "Factory/Rhythmic");
+    }
+}
+
 void QuackerPresets::loadAllFactoryPresets(QuackerVSTAudioProcessor& processor) {
     // Clear any previous factory presets
     processor.getPresetManager().clearFactoryPresets();
@@ -331,6 +367,17 @@ void QuackerPresets::loadRhythmicPresets(QuackerVSTAudioProcessor& processor) {
     if (auto* waveshapeWaveformParam = apvts.getParameter("waveshapeWaveform"))
         waveshapeWaveformParam->setValueNotifyingHost(waveshapeWaveformParam->convertTo0to1(15)); // Smooth Random
     presetManager.savePreset("Trap Hi-Hat", "Factory/Rhythmic");
+    
+    // --- Gated patterns ---
+    savePatternPreset(processor, "Trance Gate", "x-x-xxx-x-x-xx-x", 0.05f, 2, 1.0f, 1.0f);
+    savePatternPreset(processor, "Offbeat Gate", "-x-x-x-x-x-x-x-x", 0.1f, 2, 0.9f, 1.0f);
+    savePatternPreset(processor, "Stutter Build", "x-x-x-x-xxxxxxxxx-x-x-x-xxxxxxxxx-x-x-x-xxxxxxxxxxxxxxxxxxxxxxxx", 0.02f, 3, 1.0f, 1.0f);
+    savePatternPreset(processor, "Swell Steps", "-oxo-oxo-oxoxxxx", 0.8f, 2, 0.8f, 0.9f);
+    
+    // Later categories are plain tremolo
+    if (auto* modeParam = apvts.getParameter("lfoMode"))
+        modeParam->setValueNotifyingHost(modeParam->convertTo0to1(0));
+    processor.setStepPattern(StepSequencer::getDefaultPattern());
 }
 
 
@@ -0,0 +1,79 @@
+/*
+  ==============================================================================
+
+    QualityGovernor.cpp
+    Created: 19 Oct 2026 2:11:09am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "QualityGovernor.h"
+
+namespace {
+    constexpr double AVERAGING_SECONDS = 0.5;
+    constexpr double STEP_DOWN_HOLD_SECONDS = 0.5;    // One averaging time, so the last step shows in the load
+    constexpr double STEP_UP_HOLD_SECONDS = 2.0;
+    constexpr double SPIKE_WINDOW_SECONDS = 1.0;
+
+    // Realtime rendering never goes above the tier the plugin has always run at
+    constexpr auto REALTIME_CEILING = QualityGovernor::Tier::Standard;
+}
+
+void QualityGovernor::prepare(double newSampleRate) noexcept {
+    sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+    tier = REALTIME_CEILING;
+    averagedLoad = 0.0f;
+    load.store(0.0f, std::memory_order_relaxed);
+    secondsSinceChange = 0.0;
+    secondsBelowStepUp = 0.0;
+    numSpikes = 0;
+    secondsInSpikeWindow = 0.0;
+}
+
+void QualityGovernor::setNonRealtime(bool isNonRealtime) noexcept {
+    nonRealtime = isNonRealtime;
+}
+
+void QualityGovernor::addMeasurement(double seconds, int numSamples) noexcept {
+    if (numSamples <= 0) {
+        return;
+    }
+
+    const double budget = numSamples / sampleRate;
+    const auto blockLoad = static_cast<float>(seconds / budget);
+
+    // Judged against the average before this block, so a spike doesn't raise its own bar
+    const bool spike = blockLoad > SPIKE_MIN_LOAD && blockLoad > SPIKE_RATIO * averagedLoad;
+
+    // One-pole average weighted by block length, so it settles in the same time at any buffer size
+    const auto weight = static_cast<float>(1.0 - std::exp(-budget / AVERAGING_SECONDS));
+    averagedLoad += weight * (blockLoad - averagedLoad);
+    load.store(averagedLoad, std::memory_order_relaxed);
+
+    secondsInSpikeWindow += budget;
+
+    if (secondsInSpikeWindow >= SPIKE_WINDOW_SECONDS) {
+        secondsInSpikeWindow = 0.0;
+        numSpikes = 0;
+    }
+
+    numSpikes += spike ? 1 : 0;
+
+    secondsSinceChange += budget;
+    secondsBelowStepUp = (averagedLoad < STEP_UP_LOAD && !spike) ? secondsBelowStepUp + budget : 0.0;
+
+    const bool overloaded = averagedLoad > STEP_DOWN_LOAD || numSpikes >= MAX_SPIKES;
+
+    if (overloaded && tier != Tier::Economy && secondsSinceChange >= STEP_DOWN_HOLD_SECONDS) {
+        tier = static_cast<Tier>(static_cast<int>(tier) - 1);
+        secondsSinceChange = 0.0;
+        secondsBelowStepUp = 0.0;
+        numSpikes = 0;
+        secondsInSpikeWindow = 0.0;
+    } else if (secondsBelowStepUp >= STEP_UP_HOLD_SECONDS && tier < REALTIME_CEILING) {
+        tier = static_cast<Tier>(static_cast<int>(tier) + 1);
+        secondsSinceChange = 0.0;
+        secondsBelowStepUp = 0.0;
+    }
+}
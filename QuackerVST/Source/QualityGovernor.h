@@ -0,0 +1,96 @@
+/*
+  ==============================================================================
+
+    QualityGovernor.h
+    Created: 19 Oct 2026 2:11:09am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+/**
+ * Picks a DSP quality tier from the measured processing load.
+ *
+ * Each block's processing time is compared with its real-time budget,
+ * numSamples / sampleRate, and the ratio is averaged over about half a
+ * second. One tremolo insert only ever uses a few percent of the budget,
+ * so the thresholds sit at that scale. Busy machines show up less in the
+ * average than as spikes: blocks that take several times the average,
+ * because the audio thread was preempted or starved of cache. Either a
+ * high average or a burst of spikes steps the tier down straight away.
+ * Stepping back up needs a low load and no spikes for a couple of
+ * seconds, so the tier doesn't flap. Offline renders always get Maximum.
+ */
+class QualityGovernor {
+public:
+    enum class Tier {
+        Economy = 0,   // Low precision, no oversampling, waveform evaluated at control rate
+        Reduced,       // Low precision, no oversampling
+        Standard,      // Medium precision with rate-dependent oversampling
+        Maximum        // High precision with rate-dependent oversampling
+    };
+
+    // Times the enclosing scope and reports it as one block's processing time
+    class ScopedMeasurement {
+    public:
+        ScopedMeasurement(QualityGovernor& g, int blockSamples) noexcept
+            : governor(g), numSamples(blockSamples), startTicks(juce::Time::getHighResolutionTicks()) {}
+
+        ~ScopedMeasurement() {
+            governor.addMeasurement(juce::Time::highResolutionTicksToSeconds(
+                                        juce::Time::getHighResolutionTicks() - startTicks),
+                                    numSamples);
+        }
+
+    private:
+        QualityGovernor& governor;
+        const int numSamples;
+        const juce::int64 startTicks;
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedMeasurement)
+    };
+
+    QualityGovernor() = default;
+    ~QualityGovernor() = default;
+
+    void prepare(double newSampleRate) noexcept;
+
+    // Offline bounces have no deadline, so they run at Maximum whatever the load
+    void setNonRealtime(bool isNonRealtime) noexcept;
+
+    void addMeasurement(double seconds, int numSamples) noexcept;
+
+    Tier getTier() const noexcept { return nonRealtime ? Tier::Maximum : tier; }
+
+    // Averaged share of the real-time budget, readable from any thread
+    float getLoad() const noexcept { return load.load(std::memory_order_relaxed); }
+
+    static constexpr float STEP_DOWN_LOAD = 0.05f;
+    static constexpr float STEP_UP_LOAD = 0.02f;
+
+    // A block counts as a spike when it takes SPIKE_RATIO times the average and at least SPIKE_MIN_LOAD
+    static constexpr float SPIKE_RATIO = 4.0f;
+    static constexpr float SPIKE_MIN_LOAD = 0.1f;
+    static constexpr int MAX_SPIKES = 3;    // Within one spike window before stepping down
+
+private:
+    double sampleRate = 44100.0;
+    bool nonRealtime = false;
+    Tier tier = Tier::Standard;
+
+    float averagedLoad = 0.0f;
+    std::atomic<float> load{ 0.0f };
+
+    // Seconds of audio processed since the tier last changed, and since the load was last high or spiked
+    double secondsSinceChange = 0.0;
+    double secondsBelowStepUp = 0.0;
+
+    // Spikes counted in the current window
+    int numSpikes = 0;
+    double secondsInSpikeWindow = 0.0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(QualityGovernor)
+};
@@ -0,0 +1,205 @@
+/*
+  ==============================================================================
+
+    RealtimeSafetyChecker.cpp
+    Created: 19 Oct 2026 3:41:52am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "RealtimeSafetyChecker.h"
+
+#if QUACKER_REALTIME_CHECKS
+
+namespace {
+    // Distinct stacks kept; later ones are still counted, just not listed
+    constexpr size_t MAX_RECORDS = 256;
+
+    // Plain thread_locals with no constructors, so operator new can read them before main() runs
+    thread_local int realtimeDepth = 0;
+    thread_local bool recording = false;    // Set while a violation is recorded, so its own allocations don't count
+
+    std::atomic<bool> enabled{ true };
+    std::atomic<int> numViolations{ 0 };
+
+    struct Registry {
+        std::mutex lock;
+        std::map<juce::String, RealtimeSafetyChecker::Record> records;  // Keyed by type and stack
+    };
+
+    Registry& getRegistry() {
+        static Registry registry;
+        return registry;
+    }
+
+    void recordViolation(RealtimeSafetyChecker::Violation type, const juce::String& context) noexcept {
+        recording = true;
+        ++numViolations;
+
+        try {
+            const auto stack = juce::SystemStats::getStackBacktrace();
+            const auto key = RealtimeSafetyChecker::getViolationName(type) + "\n" + stack;
+            bool isNew = false;
+
+            {
+                auto& registry = getRegistry();
+                const std::lock_guard<std::mutex> guard(registry.lock);
+                auto it = registry.records.find(key);
+
+                if (it != registry.records.end()) {
+                    ++it->second.count;
+                } else if (registry.records.size() < MAX_RECORDS) {
+                    registry.records.emplace(key, RealtimeSafetyChecker::Record{ type, context, stack, 1 });
+                    isNew = true;
+                }
+            }
+
+            if (isNew) {
+                DBG("Realtime violation: " + RealtimeSafetyChecker::getViolationName(type)
+                    + (context.isNotEmpty() ? " (" + context + ")" : juce::String()) + "\n" + stack);
+            }
+        }
+        catch (...) {
+            // Out of memory while reporting; the count above still has it
+        }
+
+        recording = false;
+    }
+}
+
+RealtimeSafetyChecker::ScopedRealtimeSection::ScopedRealtimeSection() noexcept
+    : counted(enabled.load(std::memory_order_relaxed)) {
+    if (counted) {
+        ++realtimeDepth;
+    }
+}
+
+RealtimeSafetyChecker::ScopedRealtimeSection::~ScopedRealtimeSection() noexcept {
+    if (counted) {
+        --realtimeDepth;
+    }
+}
+
+void RealtimeSafetyChecker::setEnabled(bool shouldBeEnabled) noexcept {
+    enabled.store(shouldBeEnabled, std::memory_order_relaxed);
+}
+
+bool RealtimeSafetyChecker::isEnabled() noexcept {
+    return enabled.load(std::memory_order_relaxed);
+}
+
+bool RealtimeSafetyChecker::isRealtimeThread() noexcept {
+    return realtimeDepth > 0;
+}
+
+void RealtimeSafetyChecker::report(Violation type, const char* context) noexcept {
+    if (realtimeDepth > 0 && !recording) {
+        recordViolation(type, juce::String(context));
+    }
+}
+
+std::vector<RealtimeSafetyChecker::Record> RealtimeSafetyChecker::getReport() {
+    auto& registry = getRegistry();
+    const std::lock_guard<std::mutex> guard(registry.lock);
+
+    std::vector<Record> result;
+    result.reserve(registry.records.size());
+
+    for (const auto& entry : registry.records) {
+        result.push_back(entry.second);
+    }
+
+    // Most frequent first, since those are the ones that hit every block
+    std::stable_sort(result.begin(), result.end(), [](const Record& a, const Record& b) {
+        return a.count > b.count;
+    });
+
+    return result;
+}
+
+int RealtimeSafetyChecker::getNumViolations() noexcept {
+    return numViolations.load();
+}
+
+void RealtimeSafetyChecker::clearReport() {
+    auto& registry = getRegistry();
+    const std::lock_guard<std::mutex> guard(registry.lock);
+    registry.records.clear();
+    numViolations = 0;
+}
+
+#else
+
+RealtimeSafetyChecker::ScopedRealtimeSection::ScopedRealtimeSection() noexcept {}
+RealtimeSafetyChecker::ScopedRealtimeSection::~ScopedRealtimeSection() noexcept {}
+
+void RealtimeSafetyChecker::setEnabled(bool) noexcept {}
+bool RealtimeSafetyChecker::isEnabled() noexcept { return false; }
+bool RealtimeSafetyChecker::isRealtimeThread() noexcept { return false; }
+void RealtimeSafetyChecker::report(Violation, const char*) noexcept {}
+std::vector<RealtimeSafetyChecker::Record> RealtimeSafetyChecker::getReport() { return {}; }
+int RealtimeSafetyChecker::getNumViolations() noexcept { return 0; }
+void RealtimeSafetyChecker::clearReport() {}
+
+#endif
+
+juce::String RealtimeSafetyChecker::getViolationName(Violation type) {
+    switch (type) {
+        case Violation::Allocation:     return "allocation";
+        case Violation::Deallocation:   return "deallocation";
+        case Violation::Lock:           return "lock";
+    }
+
+    return {};
+}
+
+//==============================================================================
+#if QUACKER_REALTIME_CHECKS && QUACKER_REALTIME_CHECK_ALLOCATIONS
+
+// Over-aligned new and delete keep the library versions, so those allocations go unchecked
+namespace {
+    void* checkedAllocate(std::size_t size) noexcept {
+        if (realtimeDepth > 0 && !recording) {
+            recordViolation(RealtimeSafetyChecker::Violation::Allocation, juce::String(size) + " bytes");
+        }
+
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void checkedFree(void* pointer) noexcept {
+        if (pointer != nullptr && realtimeDepth > 0 && !recording) {
+            recordViolation(RealtimeSafetyChecker::Violation::Deallocation, {});
+        }
+
+        std::free(pointer);
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (auto* pointer = checkedAllocate(size)) {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (auto* pointer = checkedAllocate(size)) {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return checkedAllocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return checkedAllocate(size); }
+
+void operator delete(void* pointer) noexcept { checkedFree(pointer); }
+void operator delete[](void* pointer) noexcept { checkedFree(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { checkedFree(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { checkedFree(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { checkedFree(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { checkedFree(pointer); }
+
+#endif
@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+
+    RealtimeSafetyChecker.h
+    Created: 19 Oct 2026 3:41:52am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// On in debug builds; test builds can define it to 1 in any configuration
+#ifndef QUACKER_REALTIME_CHECKS
+ #if JUCE_DEBUG
+  #define QUACKER_REALTIME_CHECKS 1
+ #else
+  #define QUACKER_REALTIME_CHECKS 0
+ #endif
+#endif
+
+// Replaces the global operator new and delete. Only reliable when they're
+// linked into an executable such as QuackerBatch. A plugin binary can't be
+// sure its replacement wins over the host's, so this is off unless asked for.
+#ifndef QUACKER_REALTIME_CHECK_ALLOCATIONS
+ #define QUACKER_REALTIME_CHECK_ALLOCATIONS 0
+#endif
+
+/**
+ * Reports audio-thread work that can block: heap allocation and taking a lock.
+ *
+ * A ScopedRealtimeSection marks the current thread as rendering audio for the
+ * span of processBlock. While a thread is marked, each of these counts as a
+ * violation:
+ *   - taking a CheckedLock;
+ *   - any operator new or delete, when allocation checks are compiled in;
+ *   - a report() call.
+ *
+ * juce::HeapBlock and juce::AudioBuffer allocate with malloc, which the
+ * operator new hook can't see, so code that may grow them on the audio
+ * thread calls report() itself.
+ *
+ * The call stack of each violation is captured. A stack seen for the first
+ * time is written to the debug log, and later hits on it only bump its
+ * count. getReport() lists every distinct violation, so test harnesses can
+ * print them or fail on them.
+ *
+ * With QUACKER_REALTIME_CHECKS off, every check compiles away and a
+ * CheckedLock is just a CriticalSection.
+ */
+class RealtimeSafetyChecker {
+public:
+    enum class Violation {
+        Allocation,
+        Deallocation,
+        Lock
+    };
+
+    struct Record {
+        Violation type = Violation::Allocation;
+        juce::String context;   // The lock's name, or the allocation size
+        juce::String stack;
+        int count = 0;
+    };
+
+    // Marks the calling thread as the audio thread until the scope ends; sections may nest
+    class ScopedRealtimeSection {
+    public:
+        ScopedRealtimeSection() noexcept;
+        ~ScopedRealtimeSection() noexcept;
+
+    private:
+        bool counted = false;   // Whether checks were enabled when the section opened
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedRealtimeSection)
+    };
+
+    // A CriticalSection that reports a violation when entered on the audio thread.
+    // tryEnter() never blocks, so it's allowed.
+    class CheckedLock {
+    public:
+        explicit CheckedLock(const char* lockName) noexcept : name(lockName) {}
+
+        void enter() const noexcept {
+            report(Violation::Lock, name);
+            section.enter();
+        }
+
+        bool tryEnter() const noexcept { return section.tryEnter(); }
+        void exit() const noexcept { section.exit(); }
+
+        using ScopedLockType = juce::GenericScopedLock<CheckedLock>;
+
+    private:
+        const char* name;
+        juce::CriticalSection section;
+
+        JUCE_DECLARE_NON_COPYABLE(CheckedLock)
+    };
+
+    // Checks are on by default when compiled in; harnesses may switch them off for timing runs
+    static void setEnabled(bool shouldBeEnabled) noexcept;
+    static bool isEnabled() noexcept;
+
+    // True inside a ScopedRealtimeSection on this thread, and never with checks compiled out
+    static bool isRealtimeThread() noexcept;
+
+    // Records a violation at the caller's stack if this is the audio thread,
+    // for blocking calls the checker can't see on its own
+    static void report(Violation type, const char* context) noexcept;
+
+    static std::vector<Record> getReport();
+    static int getNumViolations() noexcept;
+    static void clearReport();
+
+    static juce::String getViolationName(Violation type);
+
+private:
+    RealtimeSafetyChecker() = delete;
+};
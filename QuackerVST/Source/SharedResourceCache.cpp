@@ -0,0 +1,30 @@
+/*
+  ==============================================================================
+
+    SharedResourceCache.cpp
+    Created: 19 Oct 2026 2:58:41am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "SharedResourceCache.h"
+
+namespace {
+    constexpr float MIN_SCALE = 1.0f;
+    constexpr float MAX_SCALE = 4.0f;
+}
+
+float SharedResourceCache::quantiseScale(float scale) noexcept {
+    return juce::jlimit(MIN_SCALE, MAX_SCALE, std::round(scale * 4.0f) * 0.25f);
+}
+
+void SharedResourceCache::removeExpired() {
+    for (auto it = resources.begin(); it != resources.end();) {
+        if (it->second.expired()) {
+            it = resources.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    SharedResourceCache.h
+    Created: 19 Oct 2026 2:58:41am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "RealtimeSafetyChecker.h"
+
+/**
+ * Expensive, read-only resources shared by every plugin instance in the
+ * process, reached through juce::SharedResourcePointer.
+ *
+ * Resources are keyed by name, sample rate and display scale, and are built
+ * on first request. The cache itself only keeps weak references. Each user
+ * holds the shared_ptr it was given, so a resource lives exactly as long as
+ * something is using it, and the next request after that rebuilds it. A
+ * hundred instances asking for the same key share one copy and pay for one
+ * build.
+ */
+class SharedResourceCache {
+public:
+    struct Key {
+        juce::String name;
+        double sampleRate = 0.0;    // Zero for resources that don't depend on it
+        float scale = 1.0f;         // Physical pixels per logical pixel, for images
+
+        bool operator<(const Key& other) const noexcept {
+            return std::tie(name, sampleRate, scale) < std::tie(other.name, other.sampleRate, other.scale);
+        }
+    };
+
+    SharedResourceCache() = default;
+    ~SharedResourceCache() = default;
+
+    // Returns the shared resource for the key, calling build() to make it if nobody holds one
+    template <typename ResourceType, typename Builder>
+    std::shared_ptr<const ResourceType> get(const Key& key, Builder&& build) {
+        const RealtimeSafetyChecker::CheckedLock::ScopedLockType lock(cacheLock);
+
+        if (auto existing = resources[key].lock()) {
+            return std::static_pointer_cast<const ResourceType>(existing);
+        }
+
+        // Built under the lock, so two instances opening at once don't both pay for it
+        removeExpired();
+        auto created = std::make_shared<const ResourceType>(build());
+        resources[key] = created;
+        return created;
+    }
+
+    // Snaps a display scale to quarter steps, so near-identical scales share one image
+    static float quantiseScale(float scale) noexcept;
+
+private:
+    void removeExpired();
+
+    RealtimeSafetyChecker::CheckedLock cacheLock{ "SharedResourceCache" };  // Never meant for the audio thread
+    std::map<Key, std::weak_ptr<const void>> resources;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SharedResourceCache)
+};
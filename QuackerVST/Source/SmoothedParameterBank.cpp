@@ -0,0 +1,126 @@
+/*
+  ==============================================================================
+
+    SmoothedParameterBank.cpp
+    Created: 19 Oct 2026 1:47:52am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "SmoothedParameterBank.h"
+
+void SmoothedParameterBank::prepare(double newSampleRate) noexcept {
+    sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+
+    for (int i = 0; i < MAX_PARAMETERS; ++i) {
+        rampLengths[i] = static_cast<int>(std::floor(rampSeconds[i] * sampleRate));
+        values[i] = targets[i];
+        remaining[i] = 0;
+        ramping[i] = false;
+    }
+
+    chunkLength = 0;
+}
+
+void SmoothedParameterBank::setRampTime(int index, double seconds) noexcept {
+    if (!juce::isPositiveAndBelow(index, MAX_PARAMETERS)) {
+        return;
+    }
+
+    rampSeconds[index] = juce::jmax(0.0, seconds);
+    rampLengths[index] = static_cast<int>(std::floor(rampSeconds[index] * sampleRate));
+}
+
+void SmoothedParameterBank::setTargetValue(int index, float newTarget) noexcept {
+    if (!juce::isPositiveAndBelow(index, MAX_PARAMETERS) || newTarget == targets[index]) {
+        return;
+    }
+
+    targets[index] = newTarget;
+
+    if (rampLengths[index] <= 0) {
+        values[index] = newTarget;
+        remaining[index] = 0;
+        return;
+    }
+
+    remaining[index] = rampLengths[index];
+    steps[index] = (newTarget - values[index]) / static_cast<float>(rampLengths[index]);
+}
+
+void SmoothedParameterBank::setCurrentAndTargetValue(int index, float newValue) noexcept {
+    if (!juce::isPositiveAndBelow(index, MAX_PARAMETERS)) {
+        return;
+    }
+
+    values[index] = newValue;
+    targets[index] = newValue;
+    remaining[index] = 0;
+}
+
+void SmoothedParameterBank::advance(int numSamples) noexcept {
+    numSamples = juce::jlimit(0, CHUNK_SIZE, numSamples);
+    chunkLength = numSamples;
+
+    for (int parameter = 0; parameter < MAX_PARAMETERS; ++parameter) {
+        chunkStartValues[parameter] = values[parameter];
+        chunkStartRemaining[parameter] = remaining[parameter];
+        ramping[parameter] = remaining[parameter] > 0;
+
+        // Settled parameters are read back as a constant, so there's nothing to render
+        if (!ramping[parameter]) {
+            continue;
+        }
+
+        const float start = values[parameter];
+        const float step = steps[parameter];
+        const int left = remaining[parameter];
+        const auto rampEnd = static_cast<float>(left);
+        float* ramp = ramps[parameter];
+
+        // Clamping the position, rather than stopping where the ramp ends, keeps this vectorized.
+        // It lands on the target to within rounding, and later chunks hold the exact target.
+        for (int i = 0; i < numSamples; ++i) {
+            ramp[i] = start + step * std::min(static_cast<float>(i + 1), rampEnd);
+        }
+
+        remaining[parameter] = juce::jmax(0, left - numSamples);
+        values[parameter] = remaining[parameter] > 0 ? start + step * static_cast<float>(numSamples) : targets[parameter];
+    }
+}
+
+void SmoothedParameterBank::skip(int numSamples) noexcept {
+    for (int parameter = 0; parameter < MAX_PARAMETERS; ++parameter) {
+        ramping[parameter] = false;
+
+        if (remaining[parameter] <= 0) {
+            continue;
+        }
+
+        if (numSamples >= remaining[parameter]) {
+            values[parameter] = targets[parameter];
+            remaining[parameter] = 0;
+        } else {
+            values[parameter] += steps[parameter] * static_cast<float>(numSamples);
+            remaining[parameter] -= numSamples;
+        }
+    }
+
+    chunkLength = 0;
+}
+
+void SmoothedParameterBank::rewindTo(int sample) noexcept {
+    sample = juce::jlimit(0, chunkLength, sample);
+
+    for (int parameter = 0; parameter < MAX_PARAMETERS; ++parameter) {
+        if (!ramping[parameter]) {
+            continue;
+        }
+
+        values[parameter] = sample > 0 ? ramps[parameter][sample - 1] : chunkStartValues[parameter];
+        remaining[parameter] = juce::jmax(0, chunkStartRemaining[parameter] - sample);
+    }
+
+    chunkLength = sample;
+}
@@ -0,0 +1,81 @@
+/*
+  ==============================================================================
+
+    SmoothedParameterBank.h
+    Created: 19 Oct 2026 1:47:52am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+/**
+ * Linear parameter smoothing for up to MAX_PARAMETERS values, rendered a chunk at a time.
+ *
+ * Instead of one getNextValue() call per smoother per sample, advance()
+ * writes the next chunk of every ramping parameter into its own buffer in
+ * a single vectorized loop. Parameters that have settled are skipped and
+ * read back as a constant, so a block with nothing moving costs a flag
+ * check per parameter. Ramps match juce::SmoothedValue's linear mode.
+ */
+class SmoothedParameterBank {
+public:
+    static constexpr int MAX_PARAMETERS = 8;
+    static constexpr int CHUNK_SIZE = 64;
+
+    SmoothedParameterBank() = default;
+    ~SmoothedParameterBank() = default;
+
+    // Ramp times are kept in seconds; prepare rescales them and snaps every parameter to its target
+    void prepare(double newSampleRate) noexcept;
+    void setRampTime(int index, double seconds) noexcept;
+
+    // Takes effect from the next chunk; use rewindTo first to retarget mid-chunk
+    void setTargetValue(int index, float newTarget) noexcept;
+    void setCurrentAndTargetValue(int index, float newValue) noexcept;
+
+    // Renders the next numSamples (at most CHUNK_SIZE) of every parameter that is still ramping
+    void advance(int numSamples) noexcept;
+
+    // Moves every parameter on by numSamples without rendering anything
+    void skip(int numSamples) noexcept;
+
+    // Cuts the last chunk short after `sample` samples, so the rest can be rendered with new targets
+    void rewindTo(int sample) noexcept;
+
+    int getChunkLength() const noexcept { return chunkLength; }
+
+    // True when the parameter holds one value across the whole rendered chunk
+    bool isSettled(int index) const noexcept { return !ramping[index]; }
+    const float* getRamp(int index) const noexcept { return ramps[index]; }
+
+    float getValue(int index, int sample) const noexcept {
+        return ramping[index] ? ramps[index][sample] : values[index];
+    }
+
+    float getCurrentValue(int index) const noexcept { return values[index]; }
+    float getTargetValue(int index) const noexcept { return targets[index]; }
+
+private:
+    alignas(32) float ramps[MAX_PARAMETERS][CHUNK_SIZE] = {};
+
+    // Per-parameter state at the end of the rendered chunk
+    float values[MAX_PARAMETERS] = {};
+    float targets[MAX_PARAMETERS] = {};
+    float steps[MAX_PARAMETERS] = {};
+    int remaining[MAX_PARAMETERS] = {};
+    bool ramping[MAX_PARAMETERS] = {};
+
+    // The same state at the start of the chunk, for rewinding
+    float chunkStartValues[MAX_PARAMETERS] = {};
+    int chunkStartRemaining[MAX_PARAMETERS] = {};
+    int chunkLength = 0;
+
+    double rampSeconds[MAX_PARAMETERS] = {};
+    int rampLengths[MAX_PARAMETERS] = {};
+    double sampleRate = 44100.0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SmoothedParameterBank)
+};
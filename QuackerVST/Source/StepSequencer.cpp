@@ -0,0 +1,176 @@
+/*
+  ==============================================================================
+
+    StepSequencer.cpp
+    Created: 19 Oct 2026 12:16:05am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "StepSequencer.h"
+#include "FastMath.h"
+
+namespace {
+    constexpr int CHUNK_SIZE = 64;
+
+    juce::String encodeBytes(const float* values, int count) {
+        juce::String encoded;
+        encoded.preallocateBytes(static_cast<size_t>(count * 2));
+
+        for (int i = 0; i < count; ++i) {
+            const int byte = juce::roundToInt(juce::jlimit(0.0f, 1.0f, values[i]) * 255.0f);
+            encoded << juce::String::toHexString(byte).paddedLeft('0', 2);
+        }
+
+        return encoded;
+    }
+
+    void decodeBytes(const juce::String& encoded, float* values, int count) {
+        for (int i = 0; i < count; ++i) {
+            const auto byte = encoded.substring(i * 2, i * 2 + 2);
+            values[i] = byte.length() == 2 ? static_cast<float>(byte.getHexValue32()) / 255.0f : 0.0f;
+        }
+    }
+}
+
+const juce::Identifier StepSequencer::patternType("Pattern");
+
+StepSequencer::StepSequencer() {
+    pattern = getDefaultPattern();
+
+    for (auto& envelope : envelopes) {
+        renderEnvelope(pattern, envelope);
+    }
+
+    smoothedDepth.reset(sampleRate, 0.05);
+}
+
+StepSequencer::Pattern StepSequencer::getDefaultPattern() noexcept {
+    Pattern gate;
+    gate.numSteps = MIN_STEPS;
+
+    for (int step = 0; step < MAX_STEPS; ++step) {
+        gate.levels[step] = (step % 2 == 0) ? 1.0f : 0.0f;
+    }
+
+    return gate;
+}
+
+void StepSequencer::setPattern(const Pattern& newPattern) {
+    pattern = newPattern;
+    pattern.numSteps = juce::jlimit(MIN_STEPS, MAX_STEPS, pattern.numSteps);
+
+    renderEnvelope(pattern, envelopes[writeIndex]);
+    writeIndex = middleIndex.exchange(writeIndex | FRESH_FLAG, std::memory_order_acq_rel) & 3;
+}
+
+void StepSequencer::renderEnvelope(const Pattern& source, Envelope& destination) noexcept {
+    const int numSteps = source.numSteps;
+    destination.numSteps = numSteps;
+
+    for (int step = 0; step < numSteps; ++step) {
+        const float previous = juce::jlimit(0.0f, 1.0f, source.levels[(step + numSteps - 1) % numSteps]);
+        const float target = juce::jlimit(0.0f, 1.0f, source.levels[step]);
+        const float slew = juce::jlimit(0.0f, 1.0f, source.slews[step]);
+        float* segment = destination.points + step * SEGMENT_SIZE;
+
+        for (int point = 0; point < SEGMENT_SIZE; ++point) {
+            const float t = static_cast<float>(point) / static_cast<float>(SEGMENT_SIZE);
+
+            if (t < slew) {
+                // Smoothstep glide from the previous step's level
+                const float x = t / slew;
+                segment[point] = previous + (target - previous) * x * x * (3.0f - 2.0f * x);
+            } else {
+                segment[point] = target;
+            }
+        }
+    }
+
+    destination.points[numSteps * SEGMENT_SIZE] = destination.points[0];
+}
+
+juce::ValueTree StepSequencer::patternToValueTree(const Pattern& source) {
+    juce::ValueTree tree(patternType);
+    tree.setProperty("steps", source.numSteps, nullptr);
+    tree.setProperty("levels", encodeBytes(source.levels, source.numSteps), nullptr);
+    tree.setProperty("slews", encodeBytes(source.slews, source.numSteps), nullptr);
+    return tree;
+}
+
+StepSequencer::Pattern StepSequencer::patternFromValueTree(const juce::ValueTree& tree) {
+    if (!tree.isValid() || !tree.hasType(patternType)) {
+        return getDefaultPattern();
+    }
+
+    Pattern loaded;
+    loaded.numSteps = juce::jlimit(MIN_STEPS, MAX_STEPS, static_cast<int>(tree.getProperty("steps", MIN_STEPS)));
+    decodeBytes(tree.getProperty("levels").toString(), loaded.levels, loaded.numSteps);
+    decodeBytes(tree.getProperty("slews").toString(), loaded.slews, loaded.numSteps);
+    return loaded;
+}
+
+void StepSequencer::prepare(double newSampleRate) noexcept {
+    sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+    smoothedDepth.reset(sampleRate, 0.05);
+    stepPosition = 0.0;
+}
+
+void StepSequencer::setStepsPerQuarter(double newStepsPerQuarter) noexcept {
+    stepsPerQuarter = juce::jlimit(0.25, 16.0, newStepsPerQuarter);
+}
+
+void StepSequencer::setDepth(float newDepth) noexcept {
+    smoothedDepth.setTargetValue(juce::jlimit(0.0f, 1.0f, newDepth));
+}
+
+void StepSequencer::process(float* gains, int numSamples, double bpm, double ppqPosition) noexcept {
+    // Pick up a pattern published since the last block
+    if (middleIndex.load(std::memory_order_acquire) & FRESH_FLAG) {
+        readIndex = middleIndex.exchange(readIndex, std::memory_order_acq_rel) & 3;
+    }
+
+    const Envelope& envelope = envelopes[readIndex];
+    const float* points = envelope.points;
+    const int tableLength = envelope.numSteps * SEGMENT_SIZE;
+    const auto numSteps = static_cast<double>(envelope.numSteps);
+    const double stepsPerSample = juce::jmax(1.0, bpm) / 60.0 * stepsPerQuarter / sampleRate;
+
+    // Lock to the host's bar position when it has one, so the pattern lands on the grid
+    if (ppqPosition >= 0.0) {
+        stepPosition = ppqPosition * stepsPerQuarter;
+    }
+
+    stepPosition = std::fmod(stepPosition, numSteps);
+
+    alignas(32) juce::int32 index[CHUNK_SIZE];
+    alignas(32) float fraction[CHUNK_SIZE], level[CHUNK_SIZE], depth[CHUNK_SIZE];
+
+    const auto tableSize = static_cast<float>(tableLength);
+    const auto step = static_cast<float>(stepsPerSample / numSteps);
+
+    for (int start = 0; start < numSamples; start += CHUNK_SIZE) {
+        const int count = std::min(CHUNK_SIZE, numSamples - start);
+        const auto startPhase = static_cast<float>(stepPosition / numSteps);
+
+        for (int i = 0; i < count; ++i) {
+            float position = FastMath::wrapPhase(startPhase + step * static_cast<float>(i)) * tableSize;
+            index[i] = std::min(static_cast<juce::int32>(position), tableLength - 1);
+            fraction[i] = position - static_cast<float>(index[i]);
+        }
+
+        for (int i = 0; i < count; ++i) {
+            level[i] = points[index[i]] + fraction[i] * (points[index[i] + 1] - points[index[i]]);
+            depth[i] = smoothedDepth.getNextValue();
+        }
+
+        float* output = gains + start;
+
+        for (int i = 0; i < count; ++i) {
+            output[i] = 1.0f - depth[i] + depth[i] * level[i];
+        }
+
+        stepPosition = std::fmod(stepPosition + stepsPerSample * count, numSteps);
+    }
+}
@@ -0,0 +1,86 @@
+/*
+  ==============================================================================
+
+    StepSequencer.h
+    Created: 19 Oct 2026 12:16:05am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+/**
+ * Tempo-locked step pattern for trance-gate style tremolo.
+ *
+ * Each step has a level and a slew, the fraction of the step spent gliding
+ * in from the previous level. When the pattern changes, the message thread
+ * renders every step into a segment of one envelope table and hands it to
+ * the audio thread through a lock-free triple buffer. The audio path is
+ * then just an indexed table read with linear interpolation. Even a slew
+ * of zero gets a ramp one table point long, which keeps hard gates from
+ * clicking.
+ */
+class StepSequencer {
+public:
+    static constexpr int MIN_STEPS = 16;
+    static constexpr int MAX_STEPS = 64;
+    static constexpr int SEGMENT_SIZE = 64;   // Table points per step
+
+    struct Pattern {
+        int numSteps = MIN_STEPS;
+        float levels[MAX_STEPS] = {};
+        float slews[MAX_STEPS] = {};
+    };
+
+    StepSequencer();
+    ~StepSequencer() = default;
+
+    // Message thread only: renders the pattern's envelope and publishes it to the audio thread.
+    // The hand-off allows one producer, so callers on other threads (host state restores)
+    // must post to the message thread rather than call this directly.
+    void setPattern(const Pattern& newPattern);
+    const Pattern& getPattern() const noexcept { return pattern; }
+
+    // Straight 16th-note gate, used when a state has no pattern stored
+    static Pattern getDefaultPattern() noexcept;
+
+    // Levels and slews are stored as one hex byte per step
+    static juce::ValueTree patternToValueTree(const Pattern& source);
+    static Pattern patternFromValueTree(const juce::ValueTree& tree);
+    static const juce::Identifier patternType;
+
+    // Audio thread
+    void prepare(double newSampleRate) noexcept;
+    void setStepsPerQuarter(double newStepsPerQuarter) noexcept;
+    void setDepth(float newDepth) noexcept;
+
+    // Fills tremolo gains; a negative ppqPosition means no transport, so the pattern free-runs at the tempo
+    void process(float* gains, int numSamples, double bpm, double ppqPosition) noexcept;
+
+private:
+    struct Envelope {
+        int numSteps = MIN_STEPS;
+        float points[MAX_STEPS * SEGMENT_SIZE + 1] = {};   // Guard point wraps to the start
+    };
+
+    static void renderEnvelope(const Pattern& source, Envelope& destination) noexcept;
+
+    // Triple buffer: the writer fills its own slot and swaps it into the middle;
+    // the reader takes the middle slot whenever it's marked fresh
+    Envelope envelopes[3];
+    std::atomic<int> middleIndex{ 1 };
+    int writeIndex = 2;
+    int readIndex = 0;
+    static constexpr int FRESH_FLAG = 4;
+
+    Pattern pattern;
+
+    juce::SmoothedValue<float> smoothedDepth;
+    double sampleRate = 44100.0;
+    double stepsPerQuarter = 4.0;
+    double stepPosition = 0.0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StepSequencer)
+};
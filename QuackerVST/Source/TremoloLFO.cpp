@@ -9,15 +9,25 @@
 */
 
 #include "TremoloLFO.h"
+#include "LFOBank.h"
 
 TremoloLFO::TremoloLFO()
 {
     // Initialize with safe defaults
     try {
-        smoothedDepth.reset(sampleRate, 0.02);
-        smoothedRate.reset(sampleRate, 0.05);
-        phaseSmoothing.reset(sampleRate, 0.015);
+        smoothers.setRampTime(DepthLane, 0.02);
+        smoothers.setRampTime(RateLane, 0.05);
+        smoothers.setRampTime(PhaseSmoothingLane, 0.015);
+        smoothers.setRampTime(MorphLane, 0.05);
+        smoothers.setRampTime(PhaseOffsetLane, 0.05);
+        smoothers.setRampTime(ShapingDepthLane, 0.02);
+        smoothers.setRampTime(ShapingRateLane, 0.05);
+        smoothers.prepare(sampleRate);
         oversampledBuffer.resize(oversamplingFactor);
+        
+        for (int shape = 0; shape < NumWaveforms; ++shape) {
+            morphTables[shape] = LFOBank::getWaveformTable(static_cast<Waveform>(shape));
+        }
     }
     catch (const std::exception& e) {
         DBG("TremoloLFO initialization error: " + juce::String(e.what()));
@@ -62,9 +72,13 @@ TremoloLFO::ErrorCode TremoloLFO::setSampleRate(double newSampleRate) {
     rateSmoothing = std::pow(0.5, 1.0 / (sampleRate * 0.005));
     
     try {
-        smoothedDepth.reset(sampleRate, 0.05);
-        smoothedRate.reset(sampleRate, 0.08);
-        phaseSmoothing.reset(sampleRate, 0.03);
+        smoothers.setRampTime(DepthLane, 0.05);
+        smoothers.setRampTime(RateLane, 0.08);
+        smoothers.setRampTime(PhaseSmoothingLane, 0.03);
+        smoothers.setRampTime(ShapingDepthLane, 0.05);
+        smoothers.setRampTime(ShapingRateLane, 0.08);
+        smoothers.prepare(sampleRate);
+        chunkPosition = 0;
         resetTransitionIncrement = 1.0f / (resetTransitionTime * static_cast<float>(sampleRate));
         
         auto result = updateOversamplingFactor();
@@ -94,7 +108,7 @@ TremoloLFO::ErrorCode TremoloLFO::setRate(float newRate) {
         lastError = ErrorCode::None;
     }
     
-    smoothedRate.setTargetValue(rate);
+    setSmoothedTarget(RateLane, rate);
     return updateOversamplingFactor();
 }
 
@@ -108,7 +122,7 @@ TremoloLFO::ErrorCode TremoloLFO::setDepth(float newDepth) {
         lastError = ErrorCode::None;
     }
     
-    smoothedDepth.setTargetValue(depth);
+    setSmoothedTarget(DepthLane, depth);
     return lastError;
 }
 
@@ -119,11 +133,14 @@ TremoloLFO::ErrorCode TremoloLFO::setWaveform(Waveform newWaveform) {
         return lastError;
     }
     
-    // Safe waveform change with phase reset for specific waveforms
+    // Safe waveform change with phase reset for specific waveforms; a morph owns the waveform instead
+    if (morphEnabled) {
+        lastError = ErrorCode::None;
+        return ErrorCode::None;
+    }
+    
     bool needsPhaseReset = (waveform != newWaveform) &&
-        (newWaveform == PulseDecay || newWaveform == GuitarPick ||
-         newWaveform == SlowGear || waveform == PulseDecay ||
-         waveform == GuitarPick || waveform == SlowGear);
+        (isOneShot(newWaveform) || isOneShot(waveform));
     
     waveform = newWaveform;
     
@@ -136,32 +153,87 @@ TremoloLFO::ErrorCode TremoloLFO::setWaveform(Waveform newWaveform) {
     return ErrorCode::None;
 }
 
+void TremoloLFO::setMorphEnabled(bool shouldMorph) noexcept {
+    if (shouldMorph && !morphEnabled) {
+        // Start from the selected waveform rather than sweeping in from Sine
+        morphPosition = static_cast<float>(waveform);
+        setSmoothedTarget(MorphLane, morphPosition);
+        snapSmoother(MorphLane);
+    }
+    
+    morphEnabled = shouldMorph;
+}
+
+void TremoloLFO::setMorphPosition(float position) noexcept {
+    morphPosition = std::isfinite(position) ? juce::jlimit(0.0f, MAX_MORPH_POSITION, position) : 0.0f;
+    setSmoothedTarget(MorphLane, morphPosition);
+    
+    if (morphEnabled) {
+        waveform = static_cast<Waveform>(juce::roundToInt(morphPosition));
+    }
+}
+
+void TremoloLFO::setSmoothedTarget(int lane, float target) noexcept {
+    if (target == smoothers.getTargetValue(lane)) {
+        return;
+    }
+    
+    // Re-render the rest of the chunk, so the new ramp starts on the next sample
+    smoothers.rewindTo(chunkPosition);
+    smoothers.setTargetValue(lane, target);
+}
+
+void TremoloLFO::snapSmoother(int lane) noexcept {
+    smoothers.rewindTo(chunkPosition);
+    smoothers.setCurrentAndTargetValue(lane, smoothers.getTargetValue(lane));
+}
+
+void TremoloLFO::advanceSmoothers() noexcept {
+    if (chunkPosition >= smoothers.getChunkLength()) {
+        smoothers.advance(SmoothedParameterBank::CHUNK_SIZE);
+        chunkPosition = 0;
+    }
+    
+    const int sample = chunkPosition++;
+    currentDepth = smoothers.getValue(DepthLane, sample);
+    currentRate = smoothers.getValue(RateLane, sample);
+    currentPhaseSmoothing = smoothers.getValue(PhaseSmoothingLane, sample);
+    currentMorph = smoothers.getValue(MorphLane, sample);
+    phaseOffset = smoothers.getValue(PhaseOffsetLane, sample);
+    waveshaper.setSmoothedValues(smoothers.getValue(ShapingRateLane, sample),
+                                 smoothers.getValue(ShapingDepthLane, sample));
+}
+
 float TremoloLFO::getNextSample() noexcept {
     // This is the real-time audio callback - no exceptions, minimal branching
+    advanceSmoothers();
+    
     if (!wasActive && !waitingForReset) {
         lastOutputValue = depth;
         return depth;
     }
 
     float output;
+    currentShaping = waveshaper.getNextShapingValue();
 
     if (waitingForReset) {
         double phaseNorm = getPhaseNormalized();
         if (!inResetTransition && (phaseNorm >= 0.99 || phaseNorm < 0.01)) {
             inResetTransition = true;
             resetTransitionPhase = 0.0f;
-            lastOutputValue = calculateCurrentValue(getPhaseWithOffset(), phaseSmoothing.getNextValue());
+            lastOutputValue = calculateCurrentValue(getPhaseWithOffset(), currentPhaseSmoothing);
         }
     }
 
     if (inResetTransition) {
         output = handleResetTransition();
+    } else if (controlInterval > 1) {
+        output = generateControlRateOutput();
     } else {
         output = generateOversampledOutput();
     }
 
-    float smoothedDepthValue = smoothedDepth.getNextValue();
-    return juce::jlimit(0.0f, 1.0f, output * smoothedDepthValue + (1.0f - smoothedDepthValue));
+    return juce::jlimit(0.0f, 1.0f, output * currentDepth + (1.0f - currentDepth));
 }
 
 TremoloLFO::ErrorCode TremoloLFO::setSyncMode(bool shouldSync, double division) {
@@ -197,7 +269,7 @@ TremoloLFO::ErrorCode TremoloLFO::setSyncMode(bool shouldSync, double division)
 TremoloLFO::ErrorCode TremoloLFO::setPhaseOffset(float offsetDegrees) {
     // Clamp to valid range
     offsetDegrees = juce::jlimit(-360.0f, 360.0f, offsetDegrees);
-    phaseOffset = offsetDegrees / 360.0f;
+    setSmoothedTarget(PhaseOffsetLane, offsetDegrees / 360.0f);
     lastError = ErrorCode::None;
     return ErrorCode::None;
 }
@@ -224,14 +296,32 @@ void TremoloLFO::updateActiveState(bool isActive, bool isPlaying) noexcept {
     wasActive = isActive;
 }
 
+void TremoloLFO::setPrecision(FastMath::Precision newPrecision) noexcept {
+    precision = newPrecision;
+    waveshaper.setPrecision(newPrecision);
+}
+
+void TremoloLFO::setOversamplingEnabled(bool shouldOversample) noexcept {
+    oversamplingEnabled = shouldOversample;
+    waveshaper.setOversamplingEnabled(shouldOversample);
+    updateOversamplingFactor();
+}
+
+void TremoloLFO::setControlInterval(int interval) noexcept {
+    controlInterval = juce::jlimit(1, MAX_CONTROL_INTERVAL, interval);
+    controlCountdown = 0;
+}
+
 void TremoloLFO::resetPhase() {
     phase = 0.0;
     accumulatedPhase = 0.0;
     currentRate = (rate > 0.0f) ? rate : 1.0f;
     
     try {
-        smoothedDepth.reset(sampleRate, 0.05);
-        smoothedRate.reset(sampleRate, 0.05);
+        snapSmoother(DepthLane);
+        snapSmoother(RateLane);
+        snapSmoother(ShapingDepthLane);
+        snapSmoother(ShapingRateLane);
         waveshaper.reset();
     }
     catch (...) {
@@ -239,6 +329,15 @@ void TremoloLFO::resetPhase() {
     }
 }
 
+void TremoloLFO::retrigger() noexcept {
+    phase = 0.0;
+    accumulatedPhase = 0.0;
+}
+
+void TremoloLFO::setCyclePosition(double position) noexcept {
+    accumulatedPhase = position - std::floor(position);
+}
+
 double TremoloLFO::getPhaseNormalized() const noexcept {
     double norm = std::fmod(accumulatedPhase, 1.0);
     return (norm < 0.0) ? norm + 1.0 : norm;
@@ -258,8 +357,7 @@ double TremoloLFO::getPhaseWithOffset() const noexcept {
 }
 
 float TremoloLFO::generateOversampledOutput() noexcept {
-    currentRate = smoothedRate.getNextValue();
-    double smoothedPhase = phaseSmoothing.getNextValue();
+    double smoothedPhase = currentPhaseSmoothing;
     
     // Safe phase increment calculation
     double phaseIncrement = (currentRate / sampleRate) / oversamplingFactor;
@@ -287,6 +385,27 @@ float TremoloLFO::generateOversampledOutput() noexcept {
     return lastOutputValue;
 }
 
+float TremoloLFO::generateControlRateOutput() noexcept {
+    double phaseIncrement = juce::jlimit(0.0, 0.5, currentRate / sampleRate);
+    
+    // Evaluate one interval ahead and glide there; the phase itself still moves every sample
+    if (controlCountdown <= 0) {
+        double aheadPhase = std::fmod(getPhaseNormalized() + phaseIncrement * controlInterval + phaseOffset, 1.0);
+        if (aheadPhase < 0.0) {
+            aheadPhase += 1.0;
+        }
+        
+        float target = calculateCurrentValue(aheadPhase, currentPhaseSmoothing);
+        controlStep = (target - lastOutputValue) / static_cast<float>(controlInterval);
+        controlCountdown = controlInterval;
+    }
+    
+    accumulatedPhase = std::fmod(accumulatedPhase + phaseIncrement, 1.0);
+    --controlCountdown;
+    lastOutputValue += controlStep;
+    return lastOutputValue;
+}
+
 float TremoloLFO::handleResetTransition() noexcept {
     resetTransitionPhase += resetTransitionIncrement;
     
@@ -306,7 +425,9 @@ float TremoloLFO::handleResetTransition() noexcept {
 TremoloLFO::ErrorCode TremoloLFO::updateOversamplingFactor() {
     int newFactor;
     
-    if (rate > sampleRate * 0.1) {
+    if (!oversamplingEnabled) {
+        newFactor = 1;
+    } else if (rate > sampleRate * 0.1) {
         newFactor = 16;
     } else if (rate > sampleRate * 0.05) {
         newFactor = 8;
@@ -348,8 +469,8 @@ float TremoloLFO::applyWaveshaping(float input) noexcept {
     // Map to [-1, 1] for shaping
     float baseValue = input * 2.0f - 1.0f;
     
-    // Get shaping value safely
-    float shapingValue = waveshaper.getNextShapingValue();
+    // This sample's shaping value, fetched once in getNextSample
+    float shapingValue = currentShaping;
     
     // Combine with limiting
     float combined = juce::jlimit(-1.0f, 1.0f, baseValue + shapingValue);
@@ -358,180 +479,166 @@ float TremoloLFO::applyWaveshaping(float input) noexcept {
     return combined * 0.5f + 0.5f;
 }
 
-float TremoloLFO::calculateCurrentValue(double outputPhase, double smoothedPhase) noexcept {
-    // Ensure phase is in valid range
-    outputPhase = juce::jlimit(0.0, 1.0, outputPhase);
-    smoothedPhase = juce::jlimit(0.0, 1.0, smoothedPhase);
+template <FastMath::Precision P>
+float TremoloLFO::evaluateWaveform(Waveform shape, float outputPhase, float smoothedPhase) noexcept {
+    using namespace FastMath;
     
-    double output = 0.0;
+    // Phases are in cycles, so sin2Pi(k * outputPhase) is sin(k * angle)
+    float output = 0.0f;
     
-    switch (waveform) {
+    switch (shape) {
+        case Custom: // Only reached without a compiled table
         case Sine: {
-            double angle = outputPhase * 2.0 * juce::MathConstants<double>::pi;
-            output = std::sin(angle) * 0.5 + 0.5;
+            output = sin2Pi<P>(outputPhase) * 0.5f + 0.5f;
             
             // Smooth interpolation
-            double nextAngle = (outputPhase + 0.01) * 2.0 * juce::MathConstants<double>::pi;
-            double nextValue = std::sin(nextAngle) * 0.5 + 0.5;
-            output = output * (1.0 - smoothedPhase) + smoothedPhase * nextValue;
+            float nextValue = sin2Pi<P>(outputPhase + 0.01f) * 0.5f + 0.5f;
+            output = output * (1.0f - smoothedPhase) + smoothedPhase * nextValue;
             break;
         }
             
         case Square:
-            output = (outputPhase < 0.5) ? 1.0 : 0.0;
+            output = (outputPhase < 0.5f) ? 1.0f : 0.0f;
             break;
             
         case Triangle:
-            output = 1.0 - std::abs(2.0 * outputPhase - 1.0);
+            output = 1.0f - std::abs(2.0f * outputPhase - 1.0f);
             break;
             
         case SawtoothUp:
         case SawtoothDown:
-            output = 1.0 - outputPhase;
+            output = 1.0f - outputPhase;
             break;
             
         case SoftSquare: {
-            const double sharpness = 10.0;
-            double centered = juce::jlimit(-1.0, 1.0, outputPhase * 2.0 - 1.0);
-            output = 1.0 / (1.0 + std::exp(-sharpness * centered));
+            const float sharpness = 10.0f;
+            float centered = juce::jlimit(-1.0f, 1.0f, outputPhase * 2.0f - 1.0f);
+            output = 1.0f / (1.0f + FastMath::exp<P>(-sharpness * centered));
             break;
         }
             
         case FenderStyle: {
-            double angle = outputPhase * 2.0 * juce::MathConstants<double>::pi;
-            double raw = std::sin(angle) +
-                        0.1 * std::sin(2.0 * angle) +
-                        0.05 * std::sin(3.0 * angle);
-            output = (raw * 0.4) + 0.5;
-            output = std::pow(juce::jlimit(0.0, 1.0, output), 1.08);
+            float raw = sin2Pi<P>(outputPhase) +
+                       0.1f * sin2Pi<P>(2.0f * outputPhase) +
+                       0.05f * sin2Pi<P>(3.0f * outputPhase);
+            output = (raw * 0.4f) + 0.5f;
+            output = FastMath::pow<P>(juce::jlimit(0.0f, 1.0f, output), 1.08f);
             break;
         }
             
         case WurlitzerStyle: {
-            double angle = outputPhase * 2.0 * juce::MathConstants<double>::pi;
-            double sineComponent = std::sin(angle);
-            double triangleComponent = 2.0 * std::abs(2.0 * (outputPhase - 0.5)) - 1.0;
-            output = (0.6 * sineComponent + 0.4 * triangleComponent) * 0.5 + 0.5;
-            output = std::pow(juce::jlimit(0.0, 1.0, output), 0.9);
+            float sineComponent = sin2Pi<P>(outputPhase);
+            float triangleComponent = 2.0f * std::abs(2.0f * (outputPhase - 0.5f)) - 1.0f;
+            output = (0.6f * sineComponent + 0.4f * triangleComponent) * 0.5f + 0.5f;
+            output = FastMath::pow<P>(juce::jlimit(0.0f, 1.0f, output), 0.9f);
             break;
         }
             
         case VoxStyle: {
-            double angle = outputPhase * 2.0 * juce::MathConstants<double>::pi;
-            double bias = 0.3;
-            output = std::sin(angle + bias * std::sin(2.0 * angle)) * 0.5 + 0.5;
-            output += 0.1 * std::sin(3.0 * angle);
+            // The 0.3 radian bias, expressed in cycles
+            const float bias = 0.3f / juce::MathConstants<float>::twoPi;
+            output = sin2Pi<P>(outputPhase + bias * sin2Pi<P>(2.0f * outputPhase)) * 0.5f + 0.5f;
+            output += 0.1f * sin2Pi<P>(3.0f * outputPhase);
             break;
         }
             
         case MagnatoneStyle: {
-            double angle = outputPhase * 2.0 * juce::MathConstants<double>::pi;
-            double sine = std::sin(angle);
-            double parabolic = 1.0 - std::pow(juce::jlimit(-1.0, 1.0, 2.0 * outputPhase - 1.0), 2.0);
-            output = (0.7 * sine + 0.3 * parabolic) * 0.5 + 0.5;
+            float sine = sin2Pi<P>(outputPhase);
+            float centered = juce::jlimit(-1.0f, 1.0f, 2.0f * outputPhase - 1.0f);
+            float parabolic = 1.0f - centered * centered;
+            output = (0.7f * sine + 0.3f * parabolic) * 0.5f + 0.5f;
             break;
         }
             
         case PulseDecay: {
-            const double decayRate = 4.0;
-            output = std::exp(-decayRate * outputPhase);
-            if (outputPhase < 0.1) {
-                output = 1.0 - (outputPhase * 10.0);
+            const float decayRate = 4.0f;
+            output = FastMath::exp<P>(-decayRate * outputPhase);
+            if (outputPhase < 0.1f) {
+                output = 1.0f - (outputPhase * 10.0f);
             }
             break;
         }
             
         case BouncingBall: {
-            double t = juce::jlimit(0.0, 1.0, outputPhase);
-            double bounce = std::abs(std::sin(std::pow(t * juce::MathConstants<double>::pi, 0.8)));
-            output = std::pow(bounce, 2.0);
+            // sin((t * pi)^0.8), with the argument converted to cycles
+            float t = juce::jlimit(0.0f, 1.0f, outputPhase);
+            float bounce = sin2Pi<P>(FastMath::pow<P>(t * juce::MathConstants<float>::pi, 0.8f)
+                                     / juce::MathConstants<float>::twoPi);
+            output = bounce * bounce;
             break;
         }
             
         case MultiSine: {
-            double angle = outputPhase * 2.0 * juce::MathConstants<double>::pi;
-            output = std::sin(angle) * 0.5;
-            output += std::sin(2.0 * angle) * 0.25;
-            output += std::sin(3.0 * angle) * 0.125;
-            output = output * 0.5 + 0.5;
+            output = sin2Pi<P>(outputPhase) * 0.5f;
+            output += sin2Pi<P>(2.0f * outputPhase) * 0.25f;
+            output += sin2Pi<P>(3.0f * outputPhase) * 0.125f;
+            output = output * 0.5f + 0.5f;
             break;
         }
             
         case OpticalStyle: {
-            double angle = outputPhase * 2.0 * juce::MathConstants<double>::pi;
-            double response = std::sin(angle);
-            if (response < 0) {
-                response = response * 0.8;
+            float response = sin2Pi<P>(outputPhase);
+            if (response < 0.0f) {
+                response = response * 0.8f;
             }
-            response += 0.15 * std::sin(2.0 * angle);
-            output = response * 0.5 + 0.5;
-            output = std::pow(juce::jlimit(0.0, 1.0, output), 1.2);
+            response += 0.15f * sin2Pi<P>(2.0f * outputPhase);
+            output = response * 0.5f + 0.5f;
+            output = FastMath::pow<P>(juce::jlimit(0.0f, 1.0f, output), 1.2f);
             break;
         }
             
         case TwinPeaks: {
-            double phase1 = juce::jlimit(0.0, 2.0, outputPhase * 2.0);
-            double phase2 = phase1 - 0.5;
-            if (phase2 < 0) phase2 += 2.0;
+            float phase1 = juce::jlimit(0.0f, 2.0f, outputPhase * 2.0f);
+            float phase2 = phase1 - 0.5f;
+            if (phase2 < 0.0f) phase2 += 2.0f;
             
-            double peak1 = std::exp(-std::pow(phase1 - 0.5, 2) * 16.0);
-            double peak2 = std::exp(-std::pow(phase2 - 0.5, 2) * 16.0);
+            float peak1 = FastMath::exp<P>(-(phase1 - 0.5f) * (phase1 - 0.5f) * 16.0f);
+            float peak2 = FastMath::exp<P>(-(phase2 - 0.5f) * (phase2 - 0.5f) * 16.0f);
             
-            output = (peak1 + peak2 * 0.8) * 0.7;
+            output = (peak1 + peak2 * 0.8f) * 0.7f;
             break;
         }
             
         case SmoothRandom: {
-            // Check cache first
-            if (std::abs(outputPhase - waveformCache.lastPhase) < 0.0001) {
-                output = waveformCache.cachedValue;
-                break;
-            }
+            // Non-integer partials give a pseudo-random feel
+            float f1 = sin2Pi<P>(outputPhase);
+            float f2 = sin2Pi<P>(outputPhase * 1.47f) * 0.5f;
+            float f3 = sin2Pi<P>(outputPhase * 2.39f) * 0.25f;
+            float f4 = sin2Pi<P>(outputPhase * 3.17f) * 0.125f;
             
-            double angle = outputPhase * 2.0 * juce::MathConstants<double>::pi;
-            double f1 = std::sin(angle);
-            double f2 = std::sin(angle * 1.47) * 0.5;
-            double f3 = std::sin(angle * 2.39) * 0.25;
-            double f4 = std::sin(angle * 3.17) * 0.125;
-            
-            output = (f1 + f2 + f3 + f4) * 0.4 + 0.5;
-            
-            // Update cache
-            waveformCache.lastPhase = outputPhase;
-            waveformCache.cachedValue = output;
+            output = (f1 + f2 + f3 + f4) * 0.4f + 0.5f;
             break;
         }
             
         case GuitarPick: {
-            const double attackTime = 0.05;
-            const double decayTime = 0.3;
+            const float attackTime = 0.05f;
+            const float decayTime = 0.3f;
             
             if (outputPhase < attackTime) {
                 output = outputPhase / attackTime;
             } else {
-                double decayPhase = juce::jlimit(0.0, 1.0, (outputPhase - attackTime) / decayTime);
-                double decay = std::exp(-decayPhase * 3.0);
-                double sustain = 0.2;
-                output = sustain + (1.0 - sustain) * decay;
+                float decayPhase = juce::jlimit(0.0f, 1.0f, (outputPhase - attackTime) / decayTime);
+                float decay = FastMath::exp<P>(-decayPhase * 3.0f);
+                float sustain = 0.2f;
+                output = sustain + (1.0f - sustain) * decay;
             }
             break;
         }
             
         case VintageChorus: {
-            double angle = outputPhase * 2.0 * juce::MathConstants<double>::pi;
-            double primary = std::sin(angle);
-            double secondary = std::sin(angle * 0.5) * 0.3;
-            double harmonics = std::sin(angle * 3.0) * 0.1;
+            float primary = sin2Pi<P>(outputPhase);
+            float secondary = sin2Pi<P>(outputPhase * 0.5f) * 0.3f;
+            float harmonics = sin2Pi<P>(outputPhase * 3.0f) * 0.1f;
             
-            output = (primary + secondary + harmonics) * 0.5 + 0.5;
+            output = (primary + secondary + harmonics) * 0.5f + 0.5f;
             break;
         }
             
         case SlowGear: {
-            double swell = 1.0 - std::exp(-outputPhase * 4.0);
-            double decay = std::exp(-juce::jmax(0.0, outputPhase - 0.7) * 8.0);
+            float swell = 1.0f - FastMath::exp<P>(-outputPhase * 4.0f);
+            float decay = FastMath::exp<P>(-juce::jmax(0.0f, outputPhase - 0.7f) * 8.0f);
             
-            if (outputPhase < 0.7) {
+            if (outputPhase < 0.7f) {
                 output = swell;
             } else {
                 output = swell * decay;
@@ -540,13 +647,90 @@ float TremoloLFO::calculateCurrentValue(double outputPhase, double smoothedPhase
         }
             
         default:
-            output = 0.5; // Safe default
+            output = 0.5f; // Safe default
+            break;
+    }
+    
+    return output;
+}
+
+float TremoloLFO::calculateCurrentValue(double outputPhase, double smoothedPhase) noexcept {
+    // Ensure phase is in valid range
+    auto phaseValue = static_cast<float>(juce::jlimit(0.0, 1.0, outputPhase));
+    auto smoothedValue = static_cast<float>(juce::jlimit(0.0, 1.0, smoothedPhase));
+    
+    float output;
+    
+    if (morphEnabled) {
+        return applyWaveshaping(juce::jlimit(0.0f, 1.0f, calculateMorphedValue(phaseValue)));
+    }
+    
+    if (waveform == Custom && customTable != nullptr) {
+        // Same cost as any table-driven shape: one interpolated read
+        return applyWaveshaping(juce::jlimit(0.0f, 1.0f, readTable(customTable, phaseValue)));
+    }
+    
+    switch (precision) {
+        case FastMath::Precision::Low:
+            output = evaluateWaveform<FastMath::Precision::Low>(waveform, phaseValue, smoothedValue);
+            break;
+            
+        case FastMath::Precision::High:
+            output = evaluateWaveform<FastMath::Precision::High>(waveform, phaseValue, smoothedValue);
+            break;
+            
+        default:
+            output = evaluateWaveform<FastMath::Precision::Medium>(waveform, phaseValue, smoothedValue);
             break;
     }
     
     // Apply waveshaping and ensure valid output range
-    output = juce::jlimit(0.0, 1.0, output);
-    return applyWaveshaping(static_cast<float>(output));
+    return applyWaveshaping(juce::jlimit(0.0f, 1.0f, output));
+}
+
+float TremoloLFO::readTable(const float* table, float outputPhase) noexcept {
+    static_assert(CUSTOM_TABLE_SIZE == LFOBank::TABLE_SIZE, "Custom and built-in tables are read the same way");
+    
+    float position = outputPhase * static_cast<float>(CUSTOM_TABLE_SIZE);
+    int index = std::min(static_cast<int>(position), CUSTOM_TABLE_SIZE - 1);
+    float fraction = position - static_cast<float>(index);
+    return table[index] + fraction * (table[index + 1] - table[index]);
+}
+
+float TremoloLFO::calculateMorphedValue(float outputPhase) const noexcept {
+    // Crossfade the two waveforms either side of the smoothed position
+    const float position = currentMorph;
+    const int lower = std::min(static_cast<int>(position), static_cast<int>(NumWaveforms) - 2);
+    const float blend = position - static_cast<float>(lower);
+    
+    auto tableFor = [this](int shape) {
+        return (shape == Custom && customTable != nullptr) ? customTable : morphTables[shape];
+    };
+    
+    const float from = readTable(tableFor(lower), outputPhase);
+    const float to = readTable(tableFor(lower + 1), outputPhase);
+    return from + blend * (to - from);
+}
+
+float TremoloLFO::getWaveformValue(Waveform shape, float outputPhase, FastMath::Precision tier) noexcept {
+    outputPhase = juce::jlimit(0.0f, 1.0f, outputPhase);
+    float output;
+    
+    switch (tier) {
+        case FastMath::Precision::Low:
+            output = evaluateWaveform<FastMath::Precision::Low>(shape, outputPhase, 0.0f);
+            break;
+            
+        case FastMath::Precision::Medium:
+            output = evaluateWaveform<FastMath::Precision::Medium>(shape, outputPhase, 0.0f);
+            break;
+            
+        default:
+            output = evaluateWaveform<FastMath::Precision::High>(shape, outputPhase, 0.0f);
+            break;
+    }
+    
+    return juce::jlimit(0.0f, 1.0f, output);
 }
 
 void TremoloLFO::storeManualRate(float manualRate) noexcept {
@@ -569,6 +753,8 @@ TremoloLFO::ErrorCode TremoloLFO::setWaveshapeParameters(float rate, float depth
     
     waveshaper.setRate(rate);
     waveshaper.setDepth(depth);
+    setSmoothedTarget(ShapingRateLane, rate);
+    setSmoothedTarget(ShapingDepthLane, depth);
     waveshaper.setWaveform(static_cast<WaveshapeLFO::Waveform>(waveform));
     waveshaper.setEnabled(enabled);
     
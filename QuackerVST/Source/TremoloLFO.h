@@ -11,6 +11,8 @@
 #pragma once
 #include <JuceHeader.h>
 #include "WaveshapeLFO.h"
+#include "FastMath.h"
+#include "SmoothedParameterBank.h"
 
 class TremoloLFO {
 public:
@@ -34,6 +36,7 @@ public:
         GuitarPick,
         VintageChorus,
         SlowGear,
+        Custom,      // User-drawn shape, read from a table set with setCustomTable
         NumWaveforms // Add this for bounds checking
     };
 
@@ -62,10 +65,57 @@ public:
     ErrorCode setPhaseOffset(float offsetDegrees);
     void setBeatPosition(double newBeatPosition);
     void resetPhase();
+    
+    // Restarts the cycle without resetting the smoothers, for retriggering on note attacks
+    void retrigger() noexcept;
+    
+    // Envelope-style shapes that only make sense when they start on a note
+    static bool isOneShot(Waveform shape) noexcept {
+        return shape == PulseDecay || shape == GuitarPick || shape == SlowGear;
+    }
+    
     float getNextSample() noexcept;
     bool isWaitingForReset() const noexcept { return waitingForReset; }
+    Waveform getWaveform() const noexcept { return waveform; }
+    
+    // Phase of the last sample, including the phase offset
+    double getCurrentPhase() const noexcept { return getPhaseWithOffset(); }
+    
+    // Position in the cycle before the phase offset, for keeping linked instances in step
+    double getCyclePosition() const noexcept { return getPhaseNormalized(); }
+    void setCyclePosition(double position) noexcept;
+    
+    // Depth of the last sample while free-running, zero while idle or easing back to rest
+    float getRunningDepth() const noexcept {
+        return ((wasActive || waitingForReset) && !inResetTransition) ? currentDepth : 0.0f;
+    }
     void updateActiveState(bool isActive, bool isPlaying) noexcept;
     ErrorCode setBPM(double bpm);
+    
+    // Compiled custom shape, CUSTOM_TABLE_SIZE + 1 points; without one, Custom plays a sine
+    void setCustomTable(const float* table) noexcept { customTable = table; }
+    static constexpr int CUSTOM_TABLE_SIZE = 2048;
+    
+    // Continuous shape: position 2.5 is halfway between Triangle and SawtoothUp.
+    // While morphing, the nearest waveform is reported by getWaveform but never resets the phase.
+    void setMorphEnabled(bool shouldMorph) noexcept;
+    void setMorphPosition(float position) noexcept;
+    bool isMorphEnabled() const noexcept { return morphEnabled; }
+    static constexpr float MAX_MORPH_POSITION = static_cast<float>(NumWaveforms - 1);
+    
+    // Accuracy tier for the waveform math, shared with the waveshaper
+    void setPrecision(FastMath::Precision newPrecision) noexcept;
+    FastMath::Precision getPrecision() const noexcept { return precision; }
+    
+    // Cheaper tiers for the quality governor: no oversampling, and a waveform evaluated
+    // every `interval` samples with a linear glide in between (1 evaluates every sample)
+    void setOversamplingEnabled(bool shouldOversample) noexcept;
+    void setControlInterval(int interval) noexcept;
+    static constexpr int MAX_CONTROL_INTERVAL = 32;
+    
+    // Unipolar (0-1) value of a waveform at a phase, without smoothing or waveshaping
+    static float getWaveformValue(Waveform shape, float outputPhase,
+                                  FastMath::Precision tier = FastMath::Precision::High) noexcept;
 
     // Convert BPM and note division to equivalent frequency with safety
     static double bpmToFrequency(double bpm, double noteDivision) noexcept {
@@ -136,10 +186,19 @@ private:
     double getPhaseNormalized() const noexcept;
     double getPhaseWithOffset() const noexcept;
     float generateOversampledOutput() noexcept;
+    float generateControlRateOutput() noexcept;
     float handleResetTransition() noexcept;
     ErrorCode updateOversamplingFactor();
     float calculateCurrentValue(double outputPhase, double smoothedPhase) noexcept;
+    
+    template <FastMath::Precision P>
+    static float evaluateWaveform(Waveform shape, float outputPhase, float smoothedPhase) noexcept;
     float applyWaveshaping(float input) noexcept;
+    float calculateMorphedValue(float outputPhase) const noexcept;
+    void advanceSmoothers() noexcept;
+    void setSmoothedTarget(int lane, float target) noexcept;
+    void snapSmoother(int lane) noexcept;
+    static float readTable(const float* table, float outputPhase) noexcept;
     
     // Validate parameters
     bool validateSampleRate(double sr) const noexcept;
@@ -155,14 +214,35 @@ private:
     float rate = 1.0f;
     float depth = 0.5f;
     Waveform waveform = Sine;
+    const float* customTable = nullptr;
+    
+    // Built-in shapes as LFOBank's shared tables, so a morph is two table reads and a lerp
+    const float* morphTables[NumWaveforms] = {};
+    bool morphEnabled = false;
+    float morphPosition = 0.0f;
     double sampleRate = 44100.0;
     double phaseOffset = 0.0;
     float currentRate = 1.0f;
     float rateSmoothing = 0.997f;
     
-    juce::SmoothedValue<float> smoothedDepth;
-    juce::SmoothedValue<float> smoothedRate;
-    juce::SmoothedValue<float> phaseSmoothing;
+    // Every continuous control, including the waveshaper's, is smoothed in one bank
+    enum SmoothedLane {
+        DepthLane,
+        RateLane,
+        PhaseSmoothingLane,
+        MorphLane,
+        PhaseOffsetLane,
+        ShapingRateLane,
+        ShapingDepthLane
+    };
+    
+    SmoothedParameterBank smoothers;
+    int chunkPosition = 0;
+    
+    // This sample's smoothed values
+    float currentDepth = 0.0f;
+    float currentPhaseSmoothing = 0.0f;
+    float currentMorph = 0.0f;
     
     bool syncedToHost = false;
     double beatPosition = 0.0;
@@ -180,18 +260,20 @@ private:
 
     int oversamplingFactor = 4;
     std::vector<float> oversampledBuffer;
+    bool oversamplingEnabled = true;
+    
+    int controlInterval = 1;
+    int controlCountdown = 0;
+    float controlStep = 0.0f;
+    
+    // The waveshaper moves once per output sample, whatever the oversampling or control rate
+    float currentShaping = 0.0f;
     
     double currentBPM = 120.0;
     float lastManualRate = 1.0f;
     
     WaveshapeLFO waveshaper;
-    
-    // Cache for complex waveform calculations
-    struct WaveformCache {
-        double lastPhase = -1.0;
-        double cachedValue = 0.0;
-    };
-    WaveformCache waveformCache;
+    FastMath::Precision precision = FastMath::Precision::Medium;
     
     // Error handling
     mutable ErrorCode lastError = ErrorCode::None;
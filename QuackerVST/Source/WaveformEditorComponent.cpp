@@ -0,0 +1,198 @@
+/*
+  ==============================================================================
+
+    WaveformEditorComponent.cpp
+    Created: 19 Oct 2026 1:24:17am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#include "WaveformEditorComponent.h"
+
+WaveformEditorComponent::WaveformEditorComponent(QuackerVSTAudioProcessor& p)
+    : audioProcessor(p)
+{
+    refreshFromProcessor();
+}
+
+void WaveformEditorComponent::refreshFromProcessor()
+{
+    const auto& customWaveform = audioProcessor.getCustomWaveform();
+
+    // Don't pull the shape out from under an active drag
+    if (dragIndex >= 0 || customWaveform.getVersion() == shownVersion)
+        return;
+
+    shape = customWaveform.getShape();
+    shownVersion = customWaveform.getVersion();
+    repaint();
+}
+
+void WaveformEditorComponent::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+
+    juce::ColourGradient bgGradient(
+        juce::Colours::black.brighter(0.1f), bounds.getX(), bounds.getY(),
+        juce::Colours::black.darker(0.2f), bounds.getX(), bounds.getBottom(),
+        false);
+    g.setGradientFill(bgGradient);
+    g.fillRect(bounds);
+
+    // Quarter-cycle grid
+    g.setColour(gridColour.withAlpha(0.1f));
+    for (int i = 1; i < 4; ++i)
+    {
+        g.drawVerticalLine(juce::roundToInt(bounds.getWidth() * i / 4.0f), bounds.getY(), bounds.getBottom());
+        g.drawHorizontalLine(juce::roundToInt(bounds.getHeight() * i / 4.0f), bounds.getX(), bounds.getRight());
+    }
+
+    // Curve, one sample per pixel
+    juce::Path curve;
+    const int numColumns = juce::jmax(2, getWidth());
+
+    for (int i = 0; i < numColumns; ++i)
+    {
+        const float phase = static_cast<float>(i) / static_cast<float>(numColumns - 1);
+        const float level = CustomWaveform::evaluate(shape, juce::jmin(phase, 0.9999f));
+        const float x = bounds.getX() + phase * bounds.getWidth();
+        const float y = bounds.getBottom() - level * bounds.getHeight();
+
+        if (i == 0)
+            curve.startNewSubPath(x, y);
+        else
+            curve.lineTo(x, y);
+    }
+
+    g.setColour(lineColour.withAlpha(0.15f));
+    g.strokePath(curve, juce::PathStrokeType(6.0f));
+    g.setColour(lineColour.withAlpha(0.95f));
+    g.strokePath(curve, juce::PathStrokeType(2.0f));
+
+    // Breakpoint handles
+    for (int i = 0; i < shape.numPoints; ++i)
+    {
+        const auto centre = pointToScreen(shape.points[i]);
+        g.setColour(i == dragIndex ? lineColour.brighter(0.4f) : lineColour);
+        g.fillEllipse(juce::Rectangle<float>(POINT_RADIUS * 2.0f, POINT_RADIUS * 2.0f).withCentre(centre));
+    }
+
+    g.setColour(gridColour.withAlpha(0.6f));
+    g.setFont(12.0f);
+    g.drawText("Custom - click to add, alt-drag to bend", bounds.removeFromTop(20), juce::Justification::centred);
+
+    g.setColour(juce::Colour(120, 80, 75));
+    g.drawRect(getLocalBounds().toFloat(), 1.0f);
+}
+
+juce::Point<float> WaveformEditorComponent::pointToScreen(const CustomWaveform::Breakpoint& point) const
+{
+    return { point.x * static_cast<float>(getWidth()),
+             (1.0f - point.y) * static_cast<float>(getHeight()) };
+}
+
+int WaveformEditorComponent::findPointAt(juce::Point<float> position) const
+{
+    for (int i = 0; i < shape.numPoints; ++i)
+    {
+        if (pointToScreen(shape.points[i]).getDistanceFrom(position) <= HIT_RADIUS)
+            return i;
+    }
+
+    return -1;
+}
+
+void WaveformEditorComponent::mouseDown(const juce::MouseEvent& e)
+{
+    const auto position = e.position;
+    const int hit = findPointAt(position);
+
+    if (e.mods.isPopupMenu())
+    {
+        removePoint(hit);
+        return;
+    }
+
+    if (hit >= 0)
+    {
+        dragIndex = hit;
+    }
+    else if (shape.numPoints < CustomWaveform::MAX_POINTS && getWidth() > 0 && getHeight() > 0)
+    {
+        // Insert in x order, so dragging only ever has to respect the neighbours
+        const float x = juce::jlimit(0.0f, 1.0f, position.x / static_cast<float>(getWidth()));
+        const float y = juce::jlimit(0.0f, 1.0f, 1.0f - position.y / static_cast<float>(getHeight()));
+
+        int index = 0;
+        while (index < shape.numPoints && shape.points[index].x <= x)
+            ++index;
+
+        for (int i = shape.numPoints; i > index; --i)
+            shape.points[i] = shape.points[i - 1];
+
+        shape.points[index] = { x, y, 0.0f };
+        ++shape.numPoints;
+        dragIndex = index;
+        commitShape();
+    }
+
+    if (dragIndex >= 0)
+        dragStartCurve = shape.points[dragIndex].curve;
+}
+
+void WaveformEditorComponent::mouseDrag(const juce::MouseEvent& e)
+{
+    if (dragIndex < 0 || getWidth() <= 0 || getHeight() <= 0)
+        return;
+
+    auto& point = shape.points[dragIndex];
+
+    if (e.mods.isAltDown())
+    {
+        // Dragging up flattens the start of the segment, dragging down steepens it
+        const float delta = static_cast<float>(e.getDistanceFromDragStartY()) / static_cast<float>(getHeight());
+        point.curve = juce::jlimit(-1.0f, 1.0f, dragStartCurve + 2.0f * delta);
+    }
+    else
+    {
+        const float lower = dragIndex > 0 ? shape.points[dragIndex - 1].x : 0.0f;
+        const float upper = dragIndex < shape.numPoints - 1 ? shape.points[dragIndex + 1].x : 1.0f;
+
+        point.x = juce::jlimit(lower, upper, e.position.x / static_cast<float>(getWidth()));
+        point.y = juce::jlimit(0.0f, 1.0f, 1.0f - e.position.y / static_cast<float>(getHeight()));
+    }
+
+    commitShape();
+}
+
+void WaveformEditorComponent::mouseUp(const juce::MouseEvent&)
+{
+    dragIndex = -1;
+    repaint();
+}
+
+void WaveformEditorComponent::mouseDoubleClick(const juce::MouseEvent& e)
+{
+    removePoint(findPointAt(e.position));
+}
+
+void WaveformEditorComponent::removePoint(int index)
+{
+    if (!juce::isPositiveAndBelow(index, shape.numPoints) || shape.numPoints <= MIN_POINTS)
+        return;
+
+    for (int i = index; i < shape.numPoints - 1; ++i)
+        shape.points[i] = shape.points[i + 1];
+
+    --shape.numPoints;
+    dragIndex = -1;
+    commitShape();
+}
+
+void WaveformEditorComponent::commitShape()
+{
+    audioProcessor.setCustomShape(shape);
+    shownVersion = audioProcessor.getCustomWaveform().getVersion();
+    repaint();
+}
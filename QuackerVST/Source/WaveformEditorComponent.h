@@ -0,0 +1,60 @@
+/*
+  ==============================================================================
+
+    WaveformEditorComponent.h
+    Created: 19 Oct 2026 1:24:17am
+    Author:  Deivids Hvostovs
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+/**
+ * Breakpoint editor for the Custom LFO waveform, shown in place of the visualizer.
+ *
+ * Click empty space to add a point, drag to move one, alt-drag to bend the
+ * segment leaving it, and double-click or right-click to remove it. Every
+ * edit is sent to the processor, which compiles the band-limited table.
+ */
+class WaveformEditorComponent : public juce::Component
+{
+public:
+    explicit WaveformEditorComponent(QuackerVSTAudioProcessor& p);
+    ~WaveformEditorComponent() override = default;
+
+    void paint(juce::Graphics& g) override;
+
+    void mouseDown(const juce::MouseEvent& e) override;
+    void mouseDrag(const juce::MouseEvent& e) override;
+    void mouseUp(const juce::MouseEvent& e) override;
+    void mouseDoubleClick(const juce::MouseEvent& e) override;
+
+    // Picks up shapes loaded from presets or state; called from the editor's timer
+    void refreshFromProcessor();
+
+private:
+    juce::Point<float> pointToScreen(const CustomWaveform::Breakpoint& point) const;
+    int findPointAt(juce::Point<float> position) const;
+    void removePoint(int index);
+    void commitShape();
+
+    QuackerVSTAudioProcessor& audioProcessor;
+
+    CustomWaveform::Shape shape;
+    juce::uint32 shownVersion = 0;
+
+    int dragIndex = -1;
+    float dragStartCurve = 0.0f;
+
+    const juce::Colour lineColour = juce::Colour(19, 224, 139);
+    const juce::Colour gridColour = juce::Colour(232, 193, 185);
+
+    static constexpr int MIN_POINTS = 2;
+    static constexpr float HIT_RADIUS = 8.0f;
+    static constexpr float POINT_RADIUS = 4.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveformEditorComponent)
+};
@@ -20,8 +20,6 @@ WaveshapeLFO::WaveshapeLFO()
     , oversamplingFactor(4)
     , lastOutputValue(0.0f)
 {
-    smoothedDepth.reset(sampleRate, 0.02);
-    smoothedRate.reset(sampleRate, 0.05);
     oversampledBuffer.resize(oversamplingFactor);
 }
 
@@ -29,26 +27,31 @@ WaveshapeLFO::WaveshapeLFO()
 
 void WaveshapeLFO::setSampleRate(double newSampleRate) {
     sampleRate = newSampleRate;
-    smoothedDepth.reset(sampleRate, 0.05);
-    smoothedRate.reset(sampleRate, 0.08);
     updateOversamplingFactor();
 }
 
 void WaveshapeLFO::setRate(float newRate) {
     rate = newRate;
-    smoothedRate.setTargetValue(newRate);
     updateOversamplingFactor();
 }
 
 void WaveshapeLFO::setDepth(float newDepth) {
     depth = newDepth;
-    smoothedDepth.setTargetValue(newDepth);
 }
 
 void WaveshapeLFO::setWaveform(Waveform newWaveform) {
     waveform = newWaveform;
 }
 
+void WaveshapeLFO::setPrecision(FastMath::Precision newPrecision) {
+    precision = newPrecision;
+}
+
+void WaveshapeLFO::setOversamplingEnabled(bool shouldOversample) {
+    oversamplingEnabled = shouldOversample;
+    updateOversamplingFactor();
+}
+
 void WaveshapeLFO::setEnabled(bool shouldBeEnabled) {
     isEnabled = shouldBeEnabled;
     if (!isEnabled) {
@@ -70,7 +73,7 @@ float WaveshapeLFO::getNextShapingValue() {
 }
 
 float WaveshapeLFO::generateOversampledOutput() {
-    float currentRate = smoothedRate.getNextValue();
+    float currentRate = smoothedRate;
     double phaseIncrement = (currentRate / sampleRate) / oversamplingFactor;
     
     for (int i = 0; i < oversamplingFactor; ++i) {
@@ -83,108 +86,109 @@ float WaveshapeLFO::generateOversampledOutput() {
         sum += oversampledBuffer[i];
     }
     
-    lastOutputValue = (sum / oversamplingFactor) * smoothedDepth.getNextValue();
+    lastOutputValue = (sum / oversamplingFactor) * smoothedDepth;
     return lastOutputValue;
 }
 
-float WaveshapeLFO::calculateCurrentValue(double phase) {
-    double output = 0.0;
-    switch (waveform) {
+template <FastMath::Precision P>
+float WaveshapeLFO::evaluateWaveform(Waveform shape, float phase) noexcept {
+    using namespace FastMath;
+    
+    // Phases are in cycles, so sin2Pi(k * phase) is sin(k * angle)
+    float output = 0.0f;
+    switch (shape) {
         case Sine:
-            output = std::sin(phase * 2.0 * juce::MathConstants<double>::pi);
+            output = sin2Pi<P>(phase);
             break;
             
         case Square:
-            output = phase < 0.5 ? 1.0 : -1.0;
+            output = phase < 0.5f ? 1.0f : -1.0f;
             break;
             
         case Triangle:
-            output = 2.0 * (phase < 0.5 ? phase * 2.0 : 2.0 * (1.0 - phase)) - 1.0;
+            output = 2.0f * (phase < 0.5f ? phase * 2.0f : 2.0f * (1.0f - phase)) - 1.0f;
             break;
             
         case SawtoothUp:
-            output = 2.0 * phase - 1.0;
+            output = 2.0f * phase - 1.0f;
             break;
             
         case SawtoothDown:
-            output = 1.0 - 2.0 * phase;
+            output = 1.0f - 2.0f * phase;
             break;
             
         case SoftSquare: {
-            const double sharpness = 10.0;
-            double centered = phase * 2.0 - 1.0;
-            output = 2.0 * (1.0 / (1.0 + std::exp(-sharpness * centered))) - 1.0;
+            const float sharpness = 10.0f;
+            float centered = phase * 2.0f - 1.0f;
+            output = 2.0f * (1.0f / (1.0f + FastMath::exp<P>(-sharpness * centered))) - 1.0f;
             break;
         }
             
         case FenderStyle: {
-            double angle = phase * 2.0 * juce::MathConstants<double>::pi;
-            output = std::sin(angle) +
-                    0.1 * std::sin(2.0 * angle) +
-                    0.05 * std::sin(3.0 * angle);
-            output = juce::jlimit(-1.0, 1.0, output);
+            output = sin2Pi<P>(phase) +
+                    0.1f * sin2Pi<P>(2.0f * phase) +
+                    0.05f * sin2Pi<P>(3.0f * phase);
+            output = juce::jlimit(-1.0f, 1.0f, output);
             break;
         }
             
         case WurlitzerStyle: {
-            double angle = phase * 2.0 * juce::MathConstants<double>::pi;
-            double sineComponent = std::sin(angle);
-            double triangleComponent = 2.0 * (phase < 0.5 ? phase * 2.0 : 2.0 * (1.0 - phase)) - 1.0;
-            output = 0.6 * sineComponent + 0.4 * triangleComponent;
+            float sineComponent = sin2Pi<P>(phase);
+            float triangleComponent = 2.0f * (phase < 0.5f ? phase * 2.0f : 2.0f * (1.0f - phase)) - 1.0f;
+            output = 0.6f * sineComponent + 0.4f * triangleComponent;
             break;
         }
             
         case VoxStyle:
         {
             // Vox-style bias tremolo emulation with slight asymmetry
-            double angle = phase * 2.0 * juce::MathConstants<double>::pi;
-            double bias = 0.3; // Adds characteristic asymmetry
-            output = std::sin(angle + bias * std::sin(2.0 * angle)) * 0.5 + 0.5;
+            const float bias = 0.3f / juce::MathConstants<float>::twoPi; // 0.3 radians, in cycles
+            output = sin2Pi<P>(phase + bias * sin2Pi<P>(2.0f * phase)) * 0.5f + 0.5f;
             // Add subtle harmonics characteristic of bias tremolo
-            output += 0.1 * std::sin(3.0 * angle);
-            output = juce::jlimit(0.0, 1.0, output);
+            output += 0.1f * sin2Pi<P>(3.0f * phase);
+            output = juce::jlimit(0.0f, 1.0f, output);
         }
         break;
 
         case MagnatoneStyle:
         {
             // Magnatone-style pitch-vibrato inspired waveshape
-            double angle = phase * 2.0 * juce::MathConstants<double>::pi;
             // Combine sine and parabolic shaping for that distinctive "pitch-varying" quality
-            double sine = std::sin(angle);
-            double parabolic = 1.0 - std::pow(2.0 * phase - 1.0, 2.0);
-            output = (0.7 * sine + 0.3 * parabolic) * 0.5 + 0.5;
+            float sine = sin2Pi<P>(phase);
+            float centered = 2.0f * phase - 1.0f;
+            float parabolic = 1.0f - centered * centered;
+            output = (0.7f * sine + 0.3f * parabolic) * 0.5f + 0.5f;
         }
         break;
             
         case PulseDecay:
         {
             // Creates a sharp attack with exponential decay
-            double decayRate = 4.0; // Adjust for different decay characteristics
-            phase = std::exp(-decayRate * phase);
-            if (phase < 0.1) // Sharp attack phase
-                output = 1.0 - (phase * 10.0);
-            output = juce::jlimit(0.0, 1.0, output);
+            float decayRate = 4.0f; // Adjust for different decay characteristics
+            float envelope = FastMath::exp<P>(-decayRate * phase);
+            if (envelope < 0.1f) // Sharp attack phase
+                output = 1.0f - (envelope * 10.0f);
+            output = juce::jlimit(0.0f, 1.0f, output);
         }
         break;
 
         case BouncingBall:
         {
             // Simulates the timing of a bouncing ball
-            double t = phase;
-            double bounce = std::abs(std::sin(std::pow(t * juce::MathConstants<double>::pi, 0.8)));
-            output = std::pow(bounce, 2.0); // Adds natural-feeling acceleration
+            float t = phase;
+            float bounce = sin2Pi<P>(FastMath::pow<P>(t * juce::MathConstants<float>::pi, 0.8f)
+                                     / juce::MathConstants<float>::twoPi);
+            output = bounce * bounce; // Adds natural-feeling acceleration
         }
         break;
             
         case MultiSine:
         {
             // Combines multiple sine waves for rich modulation
-            double angle = phase * 2.0 * juce::MathConstants<double>::pi;
-            output = std::sin(angle) * 0.5;
-            output += std::sin(2.0 * angle) * 0.25;
-            output += std::sin(3.0 * angle) * 0.125;
-            output = output * 0.5 + 0.5;
+            output = sin2Pi<P>(phase) * 0.5f;
+            output += sin2Pi<P>(2.0f * phase) * 0.25f;
+            output += sin2Pi<P>(3.0f * phase) * 0.125f;
+            output = output * 0.5f + 0.5f;
         }
         break;
             
@@ -192,16 +196,15 @@ float WaveshapeLFO::calculateCurrentValue(double phase) {
         {
             // Emulates the response of optical tremolo circuits like those found in vintage Fender amps
             // Characterized by a smooth, asymmetrical response due to the photocell behavior
-            double angle = phase * 2.0 * juce::MathConstants<double>::pi;
-            double response = std::sin(angle);
+            float response = sin2Pi<P>(phase);
             // Add photocell-like "lag" on the decay
-            if (response < 0) {
-                response = response * 0.8;  // Slower decay
+            if (response < 0.0f) {
+                response = response * 0.8f;  // Slower decay
             }
             // Add subtle harmonics characteristic of optical circuits
-            response += 0.15 * std::sin(2.0 * angle);
-            output = response * 0.5 + 0.5;
-            output = std::pow(output, 1.2); // Slight non-linear shaping
+            response += 0.15f * sin2Pi<P>(2.0f * phase);
+            output = response * 0.5f + 0.5f;
+            output = FastMath::pow<P>(juce::jmax(0.0f, output), 1.2f); // Slight non-linear shaping
         }
         break;
 
@@ -209,40 +212,29 @@ float WaveshapeLFO::calculateCurrentValue(double phase) {
         {
             // Creates a distinctive dual-peak wave that produces a "double-pulse" effect
             // Useful for rhythmic tremolo effects
-            double phase1 = phase * 2.0;
-            double phase2 = phase1 - 0.5;
-            if (phase2 < 0) phase2 += 2.0;
+            float phase1 = phase * 2.0f;
+            float phase2 = phase1 - 0.5f;
+            if (phase2 < 0.0f) phase2 += 2.0f;
             
             // Create two gaussian-like peaks
-            double peak1 = std::exp(-std::pow(phase1 - 0.5, 2) * 16.0);
-            double peak2 = std::exp(-std::pow(phase2 - 0.5, 2) * 16.0);
+            float peak1 = FastMath::exp<P>(-(phase1 - 0.5f) * (phase1 - 0.5f) * 16.0f);
+            float peak2 = FastMath::exp<P>(-(phase2 - 0.5f) * (phase2 - 0.5f) * 16.0f);
             
-            output = (peak1 + peak2 * 0.8) * 0.7; // Second peak slightly lower
+            output = (peak1 + peak2 * 0.8f) * 0.7f; // Second peak slightly lower
         }
         break;
 
         case SmoothRandom:
         {
-            // First check cache before doing any calculations
-            if (std::abs(phase - waveformCache.lastPhase) < 0.0001) {
-                output = waveformCache.cachedValue;
-                break;  // Exit early if using cached value
-            }
-            
             // Calculate the base waveform
-            double angle = phase * 2.0 * juce::MathConstants<double>::pi;
-            double f1 = std::sin(angle);
-            double f2 = std::sin(angle * 1.47) * 0.5;  // Non-integer relationship creates pseudo-random feel
-            double f3 = std::sin(angle * 2.39) * 0.25;
-            double f4 = std::sin(angle * 3.17) * 0.125;
+            float f1 = sin2Pi<P>(phase);
+            float f2 = sin2Pi<P>(phase * 1.47f) * 0.5f;  // Non-integer relationship creates pseudo-random feel
+            float f3 = sin2Pi<P>(phase * 2.39f) * 0.25f;
+            float f4 = sin2Pi<P>(phase * 3.17f) * 0.125f;
             
             // Calculate output and normalize to 0-1 range
-            output = (f1 + f2 + f3 + f4) * 0.4 + 0.5;
-            output = juce::jlimit(0.0, 1.0, output);
-            
-            // Cache the final, limited value
-            waveformCache.lastPhase = phase;
-            waveformCache.cachedValue = output;
+            output = (f1 + f2 + f3 + f4) * 0.4f + 0.5f;
+            output = juce::jlimit(0.0f, 1.0f, output);
         }
         break;
 
@@ -250,18 +242,18 @@ float WaveshapeLFO::calculateCurrentValue(double phase) {
         {
             // Emulates the envelope of a picked guitar string
             // Fast attack, natural decay, slight sustain
-            const double attackTime = 0.05;
-            const double decayTime = 0.3;
+            const float attackTime = 0.05f;
+            const float decayTime = 0.3f;
             
             if (phase < attackTime) {
                 // Sharp attack
                 output = phase / attackTime;
             } else {
                 // Natural decay with slight sustain
-                double decayPhase = (phase - attackTime) / decayTime;
-                double decay = std::exp(-decayPhase * 3.0);
-                double sustain = 0.2;  // Sustain level
-                output = sustain + (1.0 - sustain) * decay;
+                float decayPhase = (phase - attackTime) / decayTime;
+                float decay = FastMath::exp<P>(-decayPhase * 3.0f);
+                float sustain = 0.2f;  // Sustain level
+                output = sustain + (1.0f - sustain) * decay;
             }
         }
         break;
@@ -270,15 +262,14 @@ float WaveshapeLFO::calculateCurrentValue(double phase) {
         {
             // Inspired by the LFO shapes found in vintage chorus units
             // Creates a more "dimensional" modulation
-            double angle = phase * 2.0 * juce::MathConstants<double>::pi;
-            double primary = std::sin(angle);
-            double secondary = std::sin(angle * 0.5) * 0.3;  // Slower secondary modulation
+            float primary = sin2Pi<P>(phase);
+            float secondary = sin2Pi<P>(phase * 0.5f) * 0.3f;  // Slower secondary modulation
             
             // Add subtle higher harmonics for richness
-            double harmonics = std::sin(angle * 3.0) * 0.1;
+            float harmonics = sin2Pi<P>(phase * 3.0f) * 0.1f;
             
-            output = (primary + secondary + harmonics) * 0.5 + 0.5;
-            output = juce::jlimit(0.0, 1.0, output);
+            output = (primary + secondary + harmonics) * 0.5f + 0.5f;
+            output = juce::jlimit(0.0f, 1.0f, output);
         }
         break;
 
@@ -286,10 +277,10 @@ float WaveshapeLFO::calculateCurrentValue(double phase) {
         {
             // Inspired by the Boss Slow Gear pedal's envelope
             // Creates a gradual swell effect
-            double swell = 1.0 - std::exp(-phase * 4.0);
-            double decay = std::exp(-(phase - 0.7) * 8.0);
+            float swell = 1.0f - FastMath::exp<P>(-phase * 4.0f);
+            float decay = FastMath::exp<P>(-(phase - 0.7f) * 8.0f);
             
-            if (phase < 0.7) {
+            if (phase < 0.7f) {
                 output = swell;
             } else {
                 output = swell * decay;
@@ -298,12 +289,29 @@ float WaveshapeLFO::calculateCurrentValue(double phase) {
         break;
             
     }
-    return static_cast<float>(output);
+    return output;
+}
+
+float WaveshapeLFO::calculateCurrentValue(double phase) {
+    auto phaseValue = static_cast<float>(phase);
+    
+    switch (precision) {
+        case FastMath::Precision::Low:
+            return evaluateWaveform<FastMath::Precision::Low>(waveform, phaseValue);
+            
+        case FastMath::Precision::High:
+            return evaluateWaveform<FastMath::Precision::High>(waveform, phaseValue);
+            
+        default:
+            return evaluateWaveform<FastMath::Precision::Medium>(waveform, phaseValue);
+    }
 }
 
 void WaveshapeLFO::updateOversamplingFactor() {
     // Adjust oversampling based on rate to maintain quality
-    if (rate > sampleRate * 0.1) {
+    if (!oversamplingEnabled) {
+        oversamplingFactor = 1;
+    } else if (rate > sampleRate * 0.1) {
         oversamplingFactor = 16;
     } else if (rate > sampleRate * 0.05) {
         oversamplingFactor = 8;
@@ -321,6 +329,4 @@ void WaveshapeLFO::updateOversamplingFactor() {
 void WaveshapeLFO::reset() {
     phase = 0.0;
     lastOutputValue = 0.0f;
-    smoothedDepth.reset(sampleRate, 0.05);
-    smoothedRate.reset(sampleRate, 0.05);
 }
@@ -10,6 +10,7 @@
 
 #pragma once
 #include <JuceHeader.h>
+#include "FastMath.h"
 
 class WaveshapeLFO {
 public:
@@ -44,14 +45,25 @@ public:
     void setDepth(float newDepth);
     void setWaveform(Waveform newWaveform);
     void setEnabled(bool shouldBeEnabled);
+    void setPrecision(FastMath::Precision newPrecision);
+    void setOversamplingEnabled(bool shouldOversample);
     float getNextShapingValue();
     void reset();
     
+    // Rate and depth arrive already smoothed, from the owning TremoloLFO's smoother bank
+    void setSmoothedValues(float currentRate, float currentDepth) noexcept {
+        smoothedRate = currentRate;
+        smoothedDepth = currentDepth;
+    }
+    
     static float normalizedToRate(float normalizedValue);
     static float rateToNormalized(float rate);
 
 private:
     float calculateCurrentValue(double phase);
+    
+    template <FastMath::Precision P>
+    static float evaluateWaveform(Waveform shape, float phase) noexcept;
     float generateOversampledOutput();
     void updateOversamplingFactor();
     
@@ -61,22 +73,17 @@ private:
     Waveform waveform = Sine;
     double sampleRate = 44100.0;
     bool isEnabled = false;
+    FastMath::Precision precision = FastMath::Precision::Medium;
     
-    juce::SmoothedValue<float> smoothedDepth;
-    juce::SmoothedValue<float> smoothedRate;
+    float smoothedDepth = 0.0f;
+    float smoothedRate = 0.0f;
     
     int oversamplingFactor = 4;
+    bool oversamplingEnabled = true;
     std::vector<float> oversampledBuffer;
     float lastOutputValue = 0.0f;
     
     juce::HeapBlock<float> waveshapeBuffer;
-    
-    // Cache for complex waveform calculations
-    struct WaveformCache {
-        double lastPhase = -1.0;
-        double cachedValue = 0.0;
-    };
-    WaveformCache waveformCache;
 
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveshapeLFO)